@@ -3,13 +3,27 @@ mkdir -p build/shader
 glslc src/shader/sun_direct_shade.comp -o build/shader/sun_direct_shade.comp.spv
 glslc src/shader/direct_shade.comp -o build/shader/direct_shade.comp.spv
 glslc src/shader/sun_direct_sampler.comp -o build/shader/sun_direct_sampler.comp.spv
+glslc -DNO_SUBGROUP_OPS src/shader/sun_direct_sampler.comp -o build/shader/sun_direct_sampler_fallback.comp.spv
 glslc src/shader/direct_sampler.comp -o build/shader/direct_sampler.comp.spv
+glslc -DNO_SUBGROUP_OPS src/shader/direct_sampler.comp -o build/shader/direct_sampler_fallback.comp.spv
 glslc src/shader/indirect_sampler.comp -o build/shader/indirect_sampler.comp.spv
 glslc src/shader/integrator.comp -o build/shader/integrator.comp.spv
+glslc src/shader/adaptive_mask.comp -o build/shader/adaptive_mask.comp.spv
+glslc -DNO_SUBGROUP_OPS src/shader/adaptive_mask.comp -o build/shader/adaptive_mask_fallback.comp.spv
+glslc src/shader/reproject.comp -o build/shader/reproject.comp.spv
+glslc src/shader/denoise_demodulate.comp -o build/shader/denoise_demodulate.comp.spv
+glslc src/shader/denoise_atrous.comp -o build/shader/denoise_atrous.comp.spv
+glslc src/shader/tonemap.comp -o build/shader/tonemap.comp.spv
+glslc src/shader/image_error.comp -o build/shader/image_error.comp.spv
 glslc src/shader/miss.comp -o build/shader/miss.comp.spv
 glslc src/shader/light_shade.comp -o build/shader/light_shade.comp.spv
 glslc src/shader/indirect_shade.comp -o build/shader/indirect_shade.comp.spv
-glslc src/shader/intersect_light.comp -o build/shader/intersect_light.comp.spv
+glslc src/shader/shade.comp -o build/shader/shade.comp.spv
+glslc src/shader/megakernel.comp -o build/shader/megakernel.comp.spv
+glslc -DNO_SUBGROUP_OPS src/shader/megakernel.comp -o build/shader/megakernel_fallback.comp.spv
 glslc src/shader/intersect_object.comp -o build/shader/intersect_object.comp.spv
-glslc src/shader/sampling.frag -o build/shader/sampling.frag.spv
-glslc src/shader/sampling.vert -o build/shader/sampling.vert.spv
+glslc src/shader/intersect_shadow.comp -o build/shader/intersect_shadow.comp.spv
+glslc src/shader/ray_sort_key.comp -o build/shader/ray_sort_key.comp.spv
+glslc src/shader/ray_sort_scan.comp -o build/shader/ray_sort_scan.comp.spv
+glslc src/shader/ray_sort_scatter.comp -o build/shader/ray_sort_scatter.comp.spv
+glslc src/shader/shade_sort_key.comp -o build/shader/shade_sort_key.comp.spv
@@ -17,13 +17,29 @@
 #include "../utils/sort/morton.hpp"
 
 namespace nugiEngine {
+	namespace {
+		EngineGraphAccess readAccess(std::vector<VkDescriptorBufferInfo> buffersInfo) { return EngineGraphAccess{ buffersInfo, EngineGraphAccessType::Read }; }
+		EngineGraphAccess writeAccess(std::vector<VkDescriptorBufferInfo> buffersInfo) { return EngineGraphAccess{ buffersInfo, EngineGraphAccessType::Write }; }
+		EngineGraphAccess readWriteAccess(std::vector<VkDescriptorBufferInfo> buffersInfo) { return EngineGraphAccess{ buffersInfo, EngineGraphAccessType::ReadWrite }; }
+		EngineGraphAccess indirectAccess(std::vector<VkDescriptorBufferInfo> buffersInfo) { return EngineGraphAccess{ buffersInfo, EngineGraphAccessType::Indirect }; }
+		EngineGraphAccess transferReadAccess(std::vector<VkDescriptorBufferInfo> buffersInfo) { return EngineGraphAccess{ buffersInfo, EngineGraphAccessType::TransferRead }; }
+		EngineGraphAccess transferWriteAccess(std::vector<VkDescriptorBufferInfo> buffersInfo) { return EngineGraphAccess{ buffersInfo, EngineGraphAccessType::TransferWrite }; }
+
+		SunLight createSunLight(float phi, float theta, glm::vec3 color) {
+			SunLight sunLight{};
+			sunLight.direction = glm::normalize(glm::vec3(glm::sin(theta) * glm::cos(phi), glm::sin(theta) * glm::sin(phi), glm::cos(theta)));
+			sunLight.color = color;
+
+			return sunLight;
+		}
+	}
+
 	EngineApp::EngineApp() {
 		this->renderer = std::make_unique<EngineHybridRenderer>(this->window, this->device);
 		this->keyboardController = std::make_shared<EngineKeyboardController>();
 		this->mouseController = std::make_shared<EngineMouseController>();
 
 		this->loadCornellBox();
-		this->loadQuadModels();
 		this->recreateSubRendererAndSubsystem();
 	}
 
@@ -31,179 +47,168 @@ namespace nugiEngine {
 
 	void EngineApp::renderLoop() {
 		while (this->isRendering) {
+			if (this->isConverged) {
+				this->waitForResume();
+				continue;
+			}
+
 			auto oldTime = std::chrono::high_resolution_clock::now();
+			RenderMode frameRenderMode = this->renderMode;
 
 			if (this->renderer->acquireFrame()) {
 				uint32_t frameIndex = 0u; // this->renderer->getFrameIndex();
 				uint32_t imageIndex = this->renderer->getImageIndex();
 
-				auto commandBuffer = this->renderer->beginCommand();
-				this->indirectImage->prepareFrame(commandBuffer, frameIndex);
-
-				// ----------- Indirect Sampler -----------
-				
-				this->indirectSamplerRender->render(commandBuffer, this->indirectSamplerDescSet->getDescriptorSets(frameIndex), this->randomSeed);
-
-				this->objectRayDataBuffer->transferToRead(commandBuffer, frameIndex);
-				this->lightRayDataBuffer->transferToRead(commandBuffer, frameIndex);
-				this->indirectSamplerBuffer->transferFromReadToWriteRead(commandBuffer, frameIndex);
-
-				// ----------- Intersect Object -----------
-
-				this->intersectObjectRender->render(commandBuffer, this->indirectIntersectObjectDescSet->getDescriptorSets(frameIndex));
-
-				this->indirectObjectHitRecordBuffer->transferToRead(commandBuffer, frameIndex);
-				this->objectRayDataBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Intersect Light -----------
-
-				this->intersectLightRender->render(commandBuffer, this->indirectIntersectLightDescSet->getDescriptorSets(frameIndex));
-
-				this->indirectLightHitRecordBuffer->transferToRead(commandBuffer, frameIndex);
-				this->lightRayDataBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Indirect Shade -----------
-
-				this->indirectShadeRender->render(commandBuffer, this->indirectShadeDescSet->getDescriptorSets(frameIndex), this->randomSeed);
-				this->indirectShadeShadeBuffer->transferToRead(commandBuffer, frameIndex);
-
-				// ----------- Light Shade -----------
-
-				this->lightShadeRender->render(commandBuffer, this->lightShadeDescSet->getDescriptorSets(frameIndex));
-				this->lightShadeBuffer->transferToRead(commandBuffer, frameIndex);
-
-				// ----------- Miss -----------
-
-				this->missRender->render(commandBuffer, this->missDescSet->getDescriptorSets(frameIndex));
-				this->missBuffer->transferToRead(commandBuffer, frameIndex);
-
-				// ----------- Direct Sampler -----------
-
-				this->directSamplerRender->render(commandBuffer, this->directSamplerDescSet->getDescriptorSets(frameIndex), this->randomSeed);
-				
-				this->directDataBuffer->transferToRead(commandBuffer, frameIndex);
-				this->objectRayDataBuffer->transferToRead(commandBuffer, frameIndex);
-				this->lightRayDataBuffer->transferToRead(commandBuffer, frameIndex);
-
-				this->directObjectHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->directLightHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Intersect Object -----------
-
-				this->intersectObjectRender->render(commandBuffer, this->directIntersectObjectDescSet->getDescriptorSets(frameIndex));
-
-				this->directObjectHitRecordBuffer->transferToRead(commandBuffer, frameIndex);
-				this->objectRayDataBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Intersect Light -----------
-
-				this->intersectLightRender->render(commandBuffer, this->directIntersectLightDescSet->getDescriptorSets(frameIndex));
-
-				this->directLightHitRecordBuffer->transferToRead(commandBuffer, frameIndex);
-				this->lightRayDataBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Direct Shade -----------
+				// The frame before has finished once its image can be acquired again, so the count it wrote is ready
+				if (this->isMaskCountPending) {
+					this->activePixelCount = this->convergenceBuffer->getActivePixelCount(frameIndex);
+					this->isMaskCountPending = false;
+				}
 
-				this->directShadeRender->render(commandBuffer, this->directShadeDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				if (this->isImageErrorPending) {
+					this->reportImageError(this->imageErrorBuffer->getImageError(frameIndex));
+					this->isImageErrorPending = false;
+				}
 
-				this->directShadeShadeBuffer->transferToRead(commandBuffer, frameIndex);
-				this->directObjectHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->directLightHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->directDataBuffer->transferToWrite(commandBuffer, frameIndex);
+				if (this->isQualityRequested.exchange(false) && frameRenderMode == RenderMode::Wavefront) {
+					this->qualityPhase = QualityPhase::Reference;
+				}
 
-				// ----------- Sun Direct Sampler -----------
+				// The timed phases decide on their own whether the image is denoised
+				bool isQualityTimed = this->qualityPhase == QualityPhase::Raw || this->qualityPhase == QualityPhase::Denoised;
+				float qualityPhaseTime = std::chrono::duration<float, std::chrono::seconds::period>(oldTime - this->qualityPhaseStart).count();
+				this->isQualityFrame = this->qualityPhase == QualityPhase::Reference || (isQualityTimed && qualityPhaseTime >= EngineApp::QUALITY_TIME_BUDGET);
 
-				this->sunDirectSamplerRender->render(commandBuffer, this->sunDirectSamplerDescSet->getDescriptorSets(frameIndex), this->randomSeed);
-				
-				this->directDataBuffer->transferToRead(commandBuffer, frameIndex);
-				this->objectRayDataBuffer->transferToRead(commandBuffer, frameIndex);
-				this->lightRayDataBuffer->transferToRead(commandBuffer, frameIndex);
-
-				this->directObjectHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->directLightHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				this->indirectObjectHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->indirectLightHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Intersect Object -----------
-
-				this->intersectObjectRender->render(commandBuffer, this->directIntersectObjectDescSet->getDescriptorSets(frameIndex));
-
-				this->directObjectHitRecordBuffer->transferToRead(commandBuffer, frameIndex);
-				this->objectRayDataBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Intersect Light -----------
-
-				this->intersectLightRender->render(commandBuffer, this->directIntersectLightDescSet->getDescriptorSets(frameIndex));
-
-				this->directLightHitRecordBuffer->transferToRead(commandBuffer, frameIndex);
-				this->lightRayDataBuffer->transferToWrite(commandBuffer, frameIndex);
+				this->isMaskFrame = frameRenderMode == RenderMode::Wavefront && 
+					(this->randomSeed == 0u || (EngineApp::ADAPTIVE_SAMPLING && this->randomSeed % EngineApp::ADAPTIVE_MASK_INTERVAL == 0u));
+				this->isDenoiseFrame = frameRenderMode == RenderMode::Wavefront && (isQualityTimed ? this->qualityPhase == QualityPhase::Denoised : this->isDenoising.load());
+				this->isReprojectFrame = EngineApp::REPROJECT_HISTORY && frameRenderMode == RenderMode::Wavefront && this->isReprojectPending;
+				this->isReprojectPending = false;
 
-				// ----------- Sun Direct Shade -----------
-
-				this->sunDirectShadeRender->render(commandBuffer, this->sunDirectShadeDescSet->getDescriptorSets(frameIndex), this->randomSeed);
-
-				this->sunDirectShadeShadeBuffer->transferToRead(commandBuffer, frameIndex);
-				this->directObjectHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->directLightHitRecordBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->directDataBuffer->transferToWrite(commandBuffer, frameIndex);
-
-				// ----------- Integrator -----------
-
-				this->integratorRender->render(commandBuffer, this->integratorDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				auto commandBuffer = this->renderer->beginCommand();
+				this->indirectImage->prepareFrame(commandBuffer, frameIndex);
 
-				this->indirectSamplerBuffer->transferFromWriteReadToRead(commandBuffer, frameIndex);
-				this->missBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->lightShadeBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->indirectShadeShadeBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->directShadeShadeBuffer->transferToWrite(commandBuffer, frameIndex);
-				this->sunDirectShadeShadeBuffer->transferToWrite(commandBuffer, frameIndex);
+				if (frameRenderMode == RenderMode::Megakernel) {
+					this->megakernelGraph->execute(commandBuffer, frameIndex);
+				} else {
+					for (this->bounceIndex = 0; this->bounceIndex < EngineApp::BOUNCES_PER_SUBMISSION; this->bounceIndex++) {
+						this->computeGraph->execute(commandBuffer, frameIndex);
+					}
+				}
 
-				// ----------- Final Sampling -----------
+				// ----------- Present -----------
 
+				// The tonemap stage of either graph wrote the image, it only has to be copied into the acquired swapchain image
 				this->indirectImage->transferFrame(commandBuffer, frameIndex);
-				this->accumulateImages->prepareFrame(commandBuffer, frameIndex);
-				
-				this->swapChainSubRenderer->beginRenderPass(commandBuffer, imageIndex);
-				this->samplingRayRender->render(commandBuffer, this->samplingDescSet->getDescriptorSets(frameIndex), this->quadModels, this->randomSeed);
-				this->swapChainSubRenderer->endRenderPass(commandBuffer);
-
+				this->indirectImage->copyToSwapChainImage(commandBuffer, frameIndex, this->renderer->getSwapChain()->getswapChainImages()[imageIndex]);
 				this->indirectImage->finishFrame(commandBuffer, frameIndex);
-				this->accumulateImages->finishFrame(commandBuffer, frameIndex);
 
 				this->renderer->endCommand(commandBuffer);
 				this->renderer->submitCommand(commandBuffer);
+				this->isMaskCountPending = this->isMaskFrame;
+				this->isImageErrorPending = this->isQualityFrame && isQualityTimed;
+
+				if (this->isImageErrorPending) {
+					this->measuredQualityPhase = this->qualityPhase;
+					this->measuredQualityFrameCount = this->randomSeed + 1u;
+				}
 
 				if (!this->renderer->presentFrame()) {
 					this->recreateSubRendererAndSubsystem();
 					this->randomSeed = 0;
+					this->isMaskCountPending = false;
+					this->isReprojectPending = false;
+
+					// The reference went with the old buffers
+					this->qualityPhase = QualityPhase::Idle;
+					this->isImageErrorPending = false;
 
 					continue;
 				}				
 
 				if (frameIndex + 1 == EngineDevice::MAX_FRAMES_IN_FLIGHT) {
-					if (this->isCameraMoved) {
-						this->isCameraMoved = false;
+					// Exchanged, so a flag the main thread raises again meanwhile is not cleared unseen
+					if (this->isCameraMoved.exchange(false)) {
 						this->randomSeed = 0;
 
+						// The history was accumulated with the camera the uniform buffer held until now
+						this->globalUbo.previousOrigin = this->renderedCameraRay.origin;
+						this->globalUbo.previousHorizontal = this->renderedCameraRay.horizontal;
+						this->globalUbo.previousVertical = this->renderedCameraRay.vertical;
+						this->globalUbo.previousLowerLeftCorner = this->renderedCameraRay.lowerLeftCorner;
+						this->isReprojectPending = frameRenderMode == RenderMode::Wavefront;
+
+						this->renderedCameraRay = CameraRay{ this->globalUbo.origin, this->globalUbo.horizontal, this->globalUbo.vertical, this->globalUbo.lowerLeftCorner };
+
 						for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
 							this->globalUniforms->writeGlobalData(i, this->globalUbo);
 						}
+
+						this->qualityPhase = QualityPhase::Idle;
+					} else if (this->isRenderModeChanged.exchange(false)) {
+						this->randomSeed = 0;
+						this->qualityPhase = QualityPhase::Idle;
+					} else if (this->isQualityFrame) {
+						this->advanceQualityPhase();
+						this->randomSeed = 0;
 					} else {
 						this->randomSeed++;
 					}
+
+					// A count from before the accumulation restarted says nothing about the new image
+					if (this->randomSeed == 0u) {
+						this->isMaskCountPending = false;
+						this->activePixelCount = this->globalUbo.imgSize.x * this->globalUbo.imgSize.y;
+					}
+
+					bool isMaskConverged = frameRenderMode == RenderMode::Wavefront && EngineApp::ADAPTIVE_SAMPLING && this->activePixelCount == 0u;
+					// A quality run is timed, it must not go idle before its budget is spent
+					bool isQualityRunning = this->qualityPhase != QualityPhase::Idle;
+					if (!isQualityRunning && (isMaskConverged || this->randomSeed >= EngineApp::MAX_ACCUMULATED_FRAMES)) {
+						std::lock_guard<std::mutex> lock(this->convergenceMutex);
+
+						// A change the main thread flagged meanwhile has to be rendered before going idle
+						if (!this->isCameraMoved && !this->isRenderModeChanged) {
+							this->isConverged = true;
+							std::cout << "Converged after " << this->randomSeed << " frames\n";
+						}
+					}
 				}				
 			}
 
 			auto newTime = std::chrono::high_resolution_clock::now();
-			this->frameTime = std::chrono::duration<float, std::chrono::seconds::period>(newTime - oldTime).count();
+			float frameTime = std::chrono::duration<float, std::chrono::seconds::period>(newTime - oldTime).count();
+			this->frameTime = frameTime;
 			oldTime = newTime;
+
+			if (this->isDenoiseFrame) {
+				this->totalDenoisedFrameTime += frameTime;
+				this->totalDenoisedFrameCount++;
+			} else {
+				this->totalFrameTimes[static_cast<uint32_t>(frameRenderMode)] += frameTime;
+				this->totalFrameCounts[static_cast<uint32_t>(frameRenderMode)]++;
+			}
 		}
 	}
 
+	void EngineApp::resumeRendering() {
+		{
+			std::lock_guard<std::mutex> lock(this->convergenceMutex);
+			this->isConverged = false;
+		}
+
+		this->convergenceCondition.notify_one();
+	}
+
+	void EngineApp::waitForResume() {
+		std::unique_lock<std::mutex> lock(this->convergenceMutex);
+		this->convergenceCondition.wait(lock, [this] { return !this->isConverged || !this->isRendering; });
+	}
+
 	void EngineApp::run() {
 		auto oldTime = std::chrono::high_resolution_clock::now();
 		uint32_t t = 0;
+		bool wasToggleKeyPressed = false, wasDenoiseKeyPressed = false, wasQualityKeyPressed = false;
 
 		this->globalUbo = this->initUbo(this->renderer->getSwapChain()->width(), this->renderer->getSwapChain()->height());
 		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
@@ -213,7 +218,13 @@ namespace nugiEngine {
 		std::thread renderThread(&EngineApp::renderLoop, std::ref(*this));
 
 		while (!this->window.shouldClose()) {
-			this->window.pollEvents();
+			// Nothing is rendered once the image has converged, so only wake up for input
+			if (this->isConverged) {
+				this->window.waitEvents();
+				oldTime = std::chrono::high_resolution_clock::now();
+			} else {
+				this->window.pollEvents();
+			}
 
 			auto newTime = std::chrono::high_resolution_clock::now();
 			float deltaTime = std::chrono::duration<float, std::chrono::seconds::period>(newTime - oldTime).count();
@@ -236,10 +247,43 @@ namespace nugiEngine {
 				this->globalUbo.lowerLeftCorner = cameraRay.lowerLeftCorner;
 				
 				this->isCameraMoved = true;
+				this->resumeRendering();
+			}
+
+			bool isToggleKeyPressed = glfwGetKey(this->window.getWindow(), TOGGLE_RENDER_MODE_KEY) == GLFW_PRESS;
+			if (isToggleKeyPressed && !wasToggleKeyPressed) {
+				this->printBenchmark();
+
+				this->renderMode = this->renderMode.load() == RenderMode::Wavefront ? RenderMode::Megakernel : RenderMode::Wavefront;
+				this->isRenderModeChanged = true;
+				this->resumeRendering();
+			}
+
+			// The statistics stay as they are, a converged image only needs one more frame to show the other output
+			bool isDenoiseKeyPressed = glfwGetKey(this->window.getWindow(), TOGGLE_DENOISE_KEY) == GLFW_PRESS;
+			if (EngineApp::DENOISE && isDenoiseKeyPressed && !wasDenoiseKeyPressed) {
+				this->isDenoising = !this->isDenoising;
+				this->resumeRendering();
+			}
+
+			// Only a converged image is worth measuring against
+			bool isQualityKeyPressed = glfwGetKey(this->window.getWindow(), MEASURE_QUALITY_KEY) == GLFW_PRESS;
+			if (EngineApp::DENOISE && isQualityKeyPressed && !wasQualityKeyPressed && this->isConverged && this->renderMode.load() == RenderMode::Wavefront) {
+				this->isQualityRequested = true;
+				this->resumeRendering();
+			}
+
+			if (this->window.wasResized() && this->isConverged) {
+				this->resumeRendering();
 			}
 
+			wasToggleKeyPressed = isToggleKeyPressed;
+			wasDenoiseKeyPressed = isDenoiseKeyPressed;
+			wasQualityKeyPressed = isQualityKeyPressed;
+
 			if (t == 10) {
-				std::string appTitle = std::string(APP_TITLE) + std::string(" | FPS: ") + std::to_string((1.0f / this->frameTime));
+				std::string modeName = this->renderMode.load() == RenderMode::Megakernel ? "Megakernel" : "Wavefront";
+				std::string appTitle = std::string(APP_TITLE) + std::string(" | ") + modeName + (this->isConverged ? std::string(" | Converged") : std::string(" | FPS: ") + std::to_string((1.0f / this->frameTime.load())));
 				glfwSetWindowTitle(this->window.getWindow(), appTitle.c_str());
 
 				t = 0;
@@ -251,9 +295,62 @@ namespace nugiEngine {
 		}
 
 		this->isRendering = false;
+		this->resumeRendering();
 		renderThread.join();
 
 		vkDeviceWaitIdle(this->device.getLogicalDevice());
+		this->printBenchmark();
+	}
+
+	// A wavefront frame runs the graph BOUNCES_PER_SUBMISSION times and each run moves every path slot one bounce, 
+	// a megakernel frame finishes one whole path per pixel. So the frame times are only comparable together with 
+	// how fast the image converges in each mode. The wavefront rate counts every slot, adaptively idled ones included.
+	// Denoised wavefront frames are counted apart, the difference to the raw ones is what the filter costs
+	void EngineApp::printBenchmark() {
+		const char* modeNames[] { "Wavefront", "Megakernel" };
+		uint32_t numPixels = this->globalUbo.imgSize.x * this->globalUbo.imgSize.y;
+		uint32_t raysPerFrame[] { numPixels * this->kernelConfig.samplesPerPixel * EngineApp::BOUNCES_PER_SUBMISSION, numPixels };
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(RenderMode::Count); i++) {
+			if (this->totalFrameCounts[i] == 0u) {
+				continue;
+			}
+
+			double averageFrameTime = this->totalFrameTimes[i] / static_cast<double>(this->totalFrameCounts[i]);
+			double megaRaysPerSecond = static_cast<double>(raysPerFrame[i]) / averageFrameTime / 1000000.0;
+
+			std::cout << modeNames[i] << ": " << averageFrameTime * 1000.0 << " ms per frame over " << this->totalFrameCounts[i] << " frames, " 
+				<< megaRaysPerSecond << (i == static_cast<uint32_t>(RenderMode::Megakernel) ? " M paths/s\n" : " M indirect rays/s\n");
+		}
+
+		if (this->totalDenoisedFrameCount > 0u) {
+			double averageFrameTime = this->totalDenoisedFrameTime / static_cast<double>(this->totalDenoisedFrameCount);
+			std::cout << "Wavefront + denoiser: " << averageFrameTime * 1000.0 << " ms per frame over " << this->totalDenoisedFrameCount << " frames\n";
+		}
+	}
+
+	void EngineApp::advanceQualityPhase() {
+		switch (this->qualityPhase) {
+			case QualityPhase::Reference: this->qualityPhase = QualityPhase::Raw; break;
+			case QualityPhase::Raw: this->qualityPhase = QualityPhase::Denoised; break;
+			default: this->qualityPhase = QualityPhase::Idle; break;
+		}
+
+		this->qualityPhaseStart = std::chrono::high_resolution_clock::now();
+	}
+
+	// The raw error is kept until the denoised run has been measured, then both are printed together
+	void EngineApp::reportImageError(ImageError imageError) {
+		if (this->measuredQualityPhase == QualityPhase::Raw) {
+			this->rawImageError = imageError;
+			this->rawQualityFrameCount = this->measuredQualityFrameCount;
+
+			return;
+		}
+
+		std::cout << "Error against the converged image after " << EngineApp::QUALITY_TIME_BUDGET << " s\n";
+		std::cout << "  Raw: " << this->rawQualityFrameCount << " frames, RMSE " << this->rawImageError.rmse << ", relMSE " << this->rawImageError.relMse << "\n";
+		std::cout << "  Denoised: " << this->measuredQualityFrameCount << " frames, RMSE " << imageError.rmse << ", relMSE " << imageError.relMse << "\n";
 	}
 
 	void EngineApp::loadCornellBox() {
@@ -392,6 +489,25 @@ namespace nugiEngine {
 		triangleLights->emplace_back(TriangleLight{ glm::uvec3(8u, 9u, 10u), glm::vec3(100.0f, 100.0f, 100.0f) });
 		triangleLights->emplace_back(TriangleLight{ glm::uvec3(10u, 11u, 8u), glm::vec3(100.0f, 100.0f, 100.0f) });
 
+		transforms.emplace_back(std::make_shared<TransformComponent>(TransformComponent{ glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(0.0f) }));
+		transformIndex = static_cast<uint32_t>(transforms.size() - 1);
+
+		objects->emplace_back(Object{ this->primitiveModel->getBvhSize(), this->primitiveModel->getPrimitiveSize(), transformIndex, 1u });
+		objectIndex = static_cast<uint32_t>(objects->size() - 1);
+
+		auto lightPrimitives = std::make_shared<std::vector<Primitive>>();
+		for (uint32_t i = 0; i < triangleLights->size(); i++) {
+			lightPrimitives->emplace_back(Primitive{ triangleLights->at(i).indices, i });
+		}
+
+		this->primitiveModel->addPrimitive(lightPrimitives, vertices);
+
+		boundBoxes.emplace_back(std::make_shared<ObjectBoundBox>(ObjectBoundBox{ static_cast<uint32_t>(boundBoxes.size() + 1), objects->at(objectIndex), lightPrimitives, transforms[transformIndex], vertices }));
+		boundBoxIndex = static_cast<uint32_t>(boundBoxes.size() - 1);
+
+		transforms[transformIndex]->objectMaximum = boundBoxes[boundBoxIndex]->getOriginalMax();
+		transforms[transformIndex]->objectMinimum = boundBoxes[boundBoxIndex]->getOriginalMin();
+
 		// ----------------------------------------------------------------------------
 
 		materials->emplace_back(Material{ glm::vec3(0.73f, 0.73f, 0.73f), 0.0f, 0.1f, 0.5f, 0u, 0u });
@@ -505,7 +621,7 @@ namespace nugiEngine {
 
 		this->objectModel = std::make_unique<EngineObjectModel>(this->device, objects, boundBoxes);
 		this->materialModel = std::make_unique<EngineMaterialModel>(this->device, materials);
-		this->lightModel = std::make_unique<EngineLightModel>(this->device, triangleLights, vertices);
+		this->lightModel = std::make_unique<EngineLightModel>(this->device, triangleLights);
 		this->transformationModel = std::make_unique<EngineTransformationModel>(this->device, transforms);
 		this->rayTraceVertexModels = std::make_unique<EngineRayTraceVertexModel>(this->device, vertices);
 
@@ -513,6 +629,7 @@ namespace nugiEngine {
 		this->primitiveModel->createBuffers();
 
 		this->numLights = static_cast<uint32_t>(triangleLights->size());
+		this->sunLight = createSunLight(glm::radians(45.0f), glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 0.0f));
 	}
 
 	void EngineApp::loadSkyLight() {
@@ -569,6 +686,25 @@ namespace nugiEngine {
 		triangleLights->emplace_back(TriangleLight{ glm::uvec3(4u, 5u, 6u), glm::vec3(0.0f, 0.0f, 0.0f) });
 		triangleLights->emplace_back(TriangleLight{ glm::uvec3(6u, 7u, 4u), glm::vec3(0.0f, 0.0f, 0.0f) });
 
+		transforms.emplace_back(std::make_shared<TransformComponent>(TransformComponent{ glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(0.0f) }));
+		transformIndex = static_cast<uint32_t>(transforms.size() - 1);
+
+		objects->emplace_back(Object{ this->primitiveModel->getBvhSize(), this->primitiveModel->getPrimitiveSize(), transformIndex, 1u });
+		objectIndex = static_cast<uint32_t>(objects->size() - 1);
+
+		auto lightPrimitives = std::make_shared<std::vector<Primitive>>();
+		for (uint32_t i = 0; i < triangleLights->size(); i++) {
+			lightPrimitives->emplace_back(Primitive{ triangleLights->at(i).indices, i });
+		}
+
+		this->primitiveModel->addPrimitive(lightPrimitives, vertices);
+
+		boundBoxes.emplace_back(std::make_shared<ObjectBoundBox>(ObjectBoundBox{ static_cast<uint32_t>(boundBoxes.size() + 1), objects->at(objectIndex), lightPrimitives, transforms[transformIndex], vertices }));
+		boundBoxIndex = static_cast<uint32_t>(boundBoxes.size() - 1);
+
+		transforms[transformIndex]->objectMaximum = boundBoxes[boundBoxIndex]->getOriginalMax();
+		transforms[transformIndex]->objectMinimum = boundBoxes[boundBoxIndex]->getOriginalMin();
+
 		// ----------------------------------------------------------------------------
 
 		// Object
@@ -595,7 +731,7 @@ namespace nugiEngine {
 
 		this->objectModel = std::make_unique<EngineObjectModel>(this->device, objects, boundBoxes);
 		this->materialModel = std::make_unique<EngineMaterialModel>(this->device, materials);
-		this->lightModel = std::make_unique<EngineLightModel>(this->device, triangleLights, vertices);
+		this->lightModel = std::make_unique<EngineLightModel>(this->device, triangleLights);
 		this->transformationModel = std::make_unique<EngineTransformationModel>(this->device, transforms);
 		this->rayTraceVertexModels = std::make_unique<EngineRayTraceVertexModel>(this->device, vertices);
 
@@ -603,31 +739,7 @@ namespace nugiEngine {
 		this->primitiveModel->createBuffers();
 
 		this->numLights = 0u;
-	}
-
-	void EngineApp::loadQuadModels() {
-		VertexModelData modelData{};
-
-		std::vector<Vertex> vertices;
-
-		Vertex vertex1 { glm::vec3(-1.0f, -1.0f, 0.0f) };
-		vertices.emplace_back(vertex1);
-
-		Vertex vertex2 { glm::vec3(1.0f, -1.0f, 0.0f) };
-		vertices.emplace_back(vertex2);
-
-		Vertex vertex3 { glm::vec3(1.0f, 1.0f, 0.0f) };
-		vertices.emplace_back(vertex3);
-
-		Vertex vertex4 { glm::vec3(-1.0f, 1.0f, 0.0f) };
-		vertices.emplace_back(vertex4);
-
-		modelData.vertices = vertices;
-		modelData.indices = {
-			0, 1, 2, 2, 3, 0
-		};
-
-		this->quadModels = std::make_shared<EngineVertexModel>(this->device, modelData);
+		this->sunLight = createSunLight(glm::radians(45.0f), glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 0.0f));
 	}
 
 	RayTraceUbo EngineApp::initUbo(uint32_t width, uint32_t height) {
@@ -640,18 +752,14 @@ namespace nugiEngine {
 		ubo.horizontal = cameraRay.horizontal;
 		ubo.vertical = cameraRay.vertical;
 		ubo.lowerLeftCorner = cameraRay.lowerLeftCorner;
+		ubo.previousOrigin = cameraRay.origin;
+		ubo.previousHorizontal = cameraRay.horizontal;
+		ubo.previousVertical = cameraRay.vertical;
+		ubo.previousLowerLeftCorner = cameraRay.lowerLeftCorner;
+		this->renderedCameraRay = cameraRay;
 		ubo.imgSize = glm::uvec2{width, height};
 		ubo.numLights = this->numLights;
-
-		float phi = glm::radians(45.0f);
-		float theta = glm::radians(45.0f);
-
-		float sunX = glm::sin(theta) * glm::cos(phi);
-		float sunY = glm::sin(theta) * glm::sin(phi);
-		float sunZ = glm::cos(theta);
-
-		ubo.sunLight.direction = glm::normalize(glm::vec3(sunX, sunY, sunZ));
-		ubo.sunLight.color = glm::vec3(0.0f, 0.0f, 0.0f);
+		ubo.sunLight = this->sunLight;
 		ubo.skyColor = glm::vec3(0.0f, 0.0f, 0.0f);
 
 		return ubo;
@@ -662,112 +770,204 @@ namespace nugiEngine {
 		uint32_t height = this->renderer->getSwapChain()->height();
 
 		std::shared_ptr<EngineDescriptorPool> descriptorPool = this->renderer->getDescriptorPool();
-		std::vector<std::shared_ptr<EngineImage>> swapChainImages = this->renderer->getSwapChain()->getswapChainImages();
-
-		this->swapChainSubRenderer = std::make_unique<EngineSwapChainSubRenderer>(this->device, this->renderer->getSwapChain()->getswapChainImages(), 
-			this->renderer->getSwapChain()->getSwapChainImageFormat(), static_cast<int>(this->renderer->getSwapChain()->imageCount()), 
-			width, height);
 
 		this->indirectImage = std::make_unique<EngineRayTraceImage>(this->device, width, height, static_cast<uint32_t>(this->renderer->getSwapChain()->imageCount()));
-		this->accumulateImages = std::make_unique<EngineAccumulateImage>(this->device, width, height, static_cast<uint32_t>(this->renderer->getSwapChain()->imageCount()));
-
-		this->objectRayDataBuffer = std::make_shared<EngineRayDataStorageBuffer>(this->device, width * height);
-		this->lightRayDataBuffer = std::make_shared<EngineRayDataStorageBuffer>(this->device, width * height);
-		this->directObjectHitRecordBuffer = std::make_shared<EngineHitRecordStorageBuffer>(this->device, width * height);
-		this->directLightHitRecordBuffer = std::make_shared<EngineHitRecordStorageBuffer>(this->device, width * height);
-		this->indirectObjectHitRecordBuffer = std::make_shared<EngineHitRecordStorageBuffer>(this->device, width * height);
-		this->indirectLightHitRecordBuffer = std::make_shared<EngineHitRecordStorageBuffer>(this->device, width * height);
-		this->indirectShadeShadeBuffer = std::make_shared<EngineIndirectShadeStorageBuffer>(this->device, width * height);
-		this->directShadeShadeBuffer = std::make_shared<EngineDirectShadeStorageBuffer>(this->device, width * height);
-		this->lightShadeBuffer = std::make_shared<EngineLightShadeStorageBuffer>(this->device, width * height);
-		this->missBuffer = std::make_shared<EngineMissRecordStorageBuffer>(this->device, width * height);
-		this->indirectSamplerBuffer = std::make_shared<EngineIndirectSamplerStorageBuffer>(this->device, sortPixelByMorton(width, height));
-		this->indirectDataBuffer = std::make_shared<EngineIndirectDataStorageBuffer>(this->device, width * height);
-		this->directDataBuffer = std::make_shared<EngineDirectDataStorageBuffer>(this->device, width * height);
-		this->sunDirectShadeShadeBuffer = std::make_shared<EngineDirectShadeStorageBuffer>(this->device, width * height);
-
-		std::vector<VkDescriptorBufferInfo> indirectShadeBufferInfos[3] {
-			this->indirectShadeShadeBuffer->getBuffersInfo(),
-			this->indirectObjectHitRecordBuffer->getBuffersInfo(),
-			this->indirectLightHitRecordBuffer->getBuffersInfo()
+
+		// A light type the scene lacks gets no direct light pass, so its buffers shrink to a placeholder the descriptor sets can still point at
+		this->hasAreaLight = this->numLights > 0u;
+		this->hasSunLight = glm::length(this->sunLight.color) > 0.0f;
+
+		this->kernelConfig = selectKernelConfig(this->device.getProperties(), this->device.getSubgroupProperties());
+		fitTraversalSpill(this->kernelConfig, std::max(this->objectModel->getBvhHeight(), this->primitiveModel->getBvhHeight()), EngineApp::SHARED_TRAVERSAL_STACK);
+		this->kernelConfig.isBackfaceCulling = EngineApp::BACKFACE_CULLING ? VK_TRUE : VK_FALSE;
+		this->kernelConfig.maxBounce = EngineApp::MAX_BOUNCE;
+		this->kernelConfig.rouletteStartBounce = EngineApp::ROULETTE_START_BOUNCE;
+		this->kernelConfig.sampleSequence = EngineApp::SAMPLE_SEQUENCE;
+		this->kernelConfig.samplesPerPixel = std::min(EngineApp::SAMPLES_PER_PIXEL, this->kernelConfig.workGroupSize);
+		this->kernelConfig.lightFlags = (this->hasAreaLight ? AREA_LIGHT_FLAG : 0u) | (this->hasSunLight ? SUN_LIGHT_FLAG : 0u);
+
+		// Every wavefront buffer below holds one entry per path slot
+		uint32_t numPaths = width * height * this->kernelConfig.samplesPerPixel;
+
+		// Sampler state and accumulated results carry over between frames, everything else only lives inside one frame.
+		// Transient buffers live from the first to the last graph stage declaring an access to them, buffers whose lifetimes never overlap share memory
+		this->indirectSamplerBuffer = std::make_shared<EngineIndirectSamplerStorageBuffer>(this->device, sortPixelByMorton(width, height, this->kernelConfig.samplesPerPixel));
+		this->indirectDataBuffer = std::make_shared<EngineIndirectDataStorageBuffer>(this->device, numPaths);
+		this->pixelStatisticsBuffer = std::make_shared<EnginePixelStatisticsStorageBuffer>(this->device, width * height);
+		this->convergenceBuffer = std::make_shared<EngineConvergenceStorageBuffer>(this->device, width * height);
+		this->activePixelCount = width * height;
+		this->pixelGuideBuffer = std::make_shared<EnginePixelGuideStorageBuffer>(this->device, width * height);
+
+		this->transientAllocator = std::make_unique<EngineTransientAllocator>(this->device);
+
+		this->rayDataBuffer = std::make_shared<EngineRayDataStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+		this->indirectHitRecordBuffer = std::make_shared<EngineHitRecordStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+		this->shadeBuffer = std::make_shared<EngineShadeStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+
+		if (this->hasAreaLight || this->hasSunLight) {
+			this->directDataBuffer = std::make_shared<EngineDirectDataStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+			this->rayQueueBuffer = std::make_shared<EngineRayQueueStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+			this->visibilityBuffer = std::make_shared<EngineVisibilityStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+		} else {
+			this->directDataBuffer = std::make_shared<EngineDirectDataStorageBuffer>(this->device, 1u);
+			this->rayQueueBuffer = std::make_shared<EngineRayQueueStorageBuffer>(this->device, 1u);
+			this->visibilityBuffer = std::make_shared<EngineVisibilityStorageBuffer>(this->device, 1u);
+		}
+
+		if (this->hasAreaLight) {
+			this->directShadeShadeBuffer = std::make_shared<EngineDirectShadeStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+		} else {
+			this->directShadeShadeBuffer = std::make_shared<EngineDirectShadeStorageBuffer>(this->device, 1u);
+		}
+
+		if (this->hasSunLight) {
+			this->sunDirectShadeShadeBuffer = std::make_shared<EngineDirectShadeStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+		} else {
+			this->sunDirectShadeShadeBuffer = std::make_shared<EngineDirectShadeStorageBuffer>(this->device, 1u);
+		}
+
+		this->raySortBuffer = std::make_shared<EngineRaySortStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+
+		// Without sorting, the order buffers must keep their identity contents for the whole run
+		if (EngineApp::SORT_INDIRECT_RAYS) {
+			this->rayOrderBuffer = std::make_shared<EngineRayOrderStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+		} else {
+			this->rayOrderBuffer = std::make_shared<EngineRayOrderStorageBuffer>(this->device, numPaths);
+		}
+
+		if (EngineApp::SORT_SHADE_HITS) {
+			this->shadeOrderBuffer = std::make_shared<EngineRayOrderStorageBuffer>(this->device, numPaths, *this->transientAllocator);
+		} else {
+			this->shadeOrderBuffer = std::make_shared<EngineRayOrderStorageBuffer>(this->device, numPaths);
+		}
+
+		// Only ever live during the filter passes and the tonemap at the end of a frame, so they overlap the path buffers in memory.
+		// Without the denoiser the tonemap set still points at one, a placeholder it never reads
+		if (EngineApp::DENOISE) {
+			this->denoisePingBuffer = std::make_shared<EngineDenoiseStorageBuffer>(this->device, width * height, *this->transientAllocator);
+			this->denoisePongBuffer = std::make_shared<EngineDenoiseStorageBuffer>(this->device, width * height, *this->transientAllocator);
+		} else {
+			this->denoisePingBuffer = std::make_shared<EngineDenoiseStorageBuffer>(this->device, 1u);
+			this->denoisePongBuffer = this->denoisePingBuffer;
+		}
+
+		// The quality run's reference outlives any frame, the errors are read back by the host
+		if (EngineApp::DENOISE) {
+			this->qualityReferenceBuffer = std::make_shared<EngineDenoiseStorageBuffer>(this->device, width * height);
+			this->imageErrorBuffer = std::make_shared<EngineImageErrorStorageBuffer>(this->device, width * height);
+		}
+
+		// Copied out before the accumulation restarts and read back once the shade pass has the new first hits
+		if (EngineApp::REPROJECT_HISTORY) {
+			this->historyStatisticsBuffer = std::make_shared<EnginePixelStatisticsStorageBuffer>(this->device, width * height, *this->transientAllocator);
+			this->historyGuideBuffer = std::make_shared<EnginePixelGuideStorageBuffer>(this->device, width * height, *this->transientAllocator);
+		}
+
+		this->workQueueBuffer = std::make_shared<EngineWorkQueueStorageBuffer>(this->device);
+
+		// Built before any descriptor set points at a transient buffer, compiling the wavefront graph gives them their memory
+		this->buildComputeGraph();
+		this->buildMegakernelGraph();
+
+		std::vector<VkDescriptorBufferInfo> shadeBufferInfos[6] {
+			this->shadeBuffer->getBuffersInfo(),
+			this->indirectHitRecordBuffer->getBuffersInfo(),
+			this->rayDataBuffer->getBuffersInfo(),
+			this->shadeOrderBuffer->getBuffersInfo(),
+			this->indirectSamplerBuffer->getBuffersInfo(),
+			this->pixelGuideBuffer->getBuffersInfo()
+		};
+
+		std::vector<VkDescriptorBufferInfo> indirectShadeBufferInfos[4] {
+			this->shadeBuffer->getBuffersInfo(),
+			this->indirectHitRecordBuffer->getBuffersInfo(),
+			this->shadeOrderBuffer->getBuffersInfo(),
+			this->indirectSamplerBuffer->getBuffersInfo()
 		};
 
 		std::vector<VkDescriptorBufferInfo> directShadeBufferInfos[4] {
 			this->directShadeShadeBuffer->getBuffersInfo(),
-			this->directObjectHitRecordBuffer->getBuffersInfo(),
-			this->directLightHitRecordBuffer->getBuffersInfo(),
-			this->directDataBuffer->getBuffersInfo()
+			this->visibilityBuffer->getBuffersInfo(),
+			this->directDataBuffer->getBuffersInfo(),
+			this->shadeOrderBuffer->getBuffersInfo()
 		};
 
 		std::vector<VkDescriptorBufferInfo> sunDirectShadeBufferInfos[4] {
 			this->sunDirectShadeShadeBuffer->getBuffersInfo(),
-			this->directObjectHitRecordBuffer->getBuffersInfo(),
-			this->directLightHitRecordBuffer->getBuffersInfo(),
-			this->directDataBuffer->getBuffersInfo()
+			this->visibilityBuffer->getBuffersInfo(),
+			this->directDataBuffer->getBuffersInfo(),
+			this->shadeOrderBuffer->getBuffersInfo()
 		};
 
-		std::vector<VkDescriptorBufferInfo> integratorBufferInfos[7] {
+		std::vector<VkDescriptorBufferInfo> integratorBufferInfos[6] {
 			this->indirectSamplerBuffer->getBuffersInfo(),
 			this->indirectDataBuffer->getBuffersInfo(),
-			this->missBuffer->getBuffersInfo(),
-			this->lightShadeBuffer->getBuffersInfo(),
-			this->indirectShadeShadeBuffer->getBuffersInfo(),
+			this->shadeBuffer->getBuffersInfo(),
 			this->directShadeShadeBuffer->getBuffersInfo(),
-			this->sunDirectShadeShadeBuffer->getBuffersInfo()
+			this->sunDirectShadeShadeBuffer->getBuffersInfo(),
+			this->pixelStatisticsBuffer->getBuffersInfo()
 		};
 
-		std::vector<VkDescriptorBufferInfo> directIntersectLightBufferInfos[2] {
-			this->directLightHitRecordBuffer->getBuffersInfo(),
-			this->lightRayDataBuffer->getBuffersInfo()
+		std::vector<VkDescriptorBufferInfo> indirectIntersectObjectBufferInfos[3] {
+			this->indirectHitRecordBuffer->getBuffersInfo(),
+			this->rayDataBuffer->getBuffersInfo(),
+			this->rayOrderBuffer->getBuffersInfo()
 		};
 
-		std::vector<VkDescriptorBufferInfo> directIntersectObjectBufferInfos[2] {
-			this->directObjectHitRecordBuffer->getBuffersInfo(),
-			this->objectRayDataBuffer->getBuffersInfo()
+		std::vector<VkDescriptorBufferInfo> raySortBufferInfos[3] {
+			this->rayDataBuffer->getBuffersInfo(),
+			this->raySortBuffer->getBuffersInfo(),
+			this->rayOrderBuffer->getBuffersInfo()
 		};
 
-		std::vector<VkDescriptorBufferInfo> indirectIntersectLightBufferInfos[2] {
-			this->indirectLightHitRecordBuffer->getBuffersInfo(),
-			this->lightRayDataBuffer->getBuffersInfo()
+		std::vector<VkDescriptorBufferInfo> shadeSortBufferInfos[3] {
+			this->indirectHitRecordBuffer->getBuffersInfo(),
+			this->raySortBuffer->getBuffersInfo(),
+			this->shadeOrderBuffer->getBuffersInfo()
 		};
 
-		std::vector<VkDescriptorBufferInfo> indirectIntersectObjectBufferInfos[2] {
-			this->indirectObjectHitRecordBuffer->getBuffersInfo(),
-			this->objectRayDataBuffer->getBuffersInfo()
+		std::vector<VkDescriptorBufferInfo> intersectShadowBufferInfos[3] {
+			this->visibilityBuffer->getBuffersInfo(),
+			this->rayDataBuffer->getBuffersInfo(),
+			this->rayQueueBuffer->getBuffersInfo()
 		};
 
 		std::vector<VkDescriptorBufferInfo> lightShadeBufferInfos[3] {
-			this->lightShadeBuffer->getBuffersInfo(),
-			this->indirectObjectHitRecordBuffer->getBuffersInfo(),
-			this->indirectLightHitRecordBuffer->getBuffersInfo()
+			this->shadeBuffer->getBuffersInfo(),
+			this->indirectHitRecordBuffer->getBuffersInfo(),
+			this->rayDataBuffer->getBuffersInfo()
 		};
 
-		std::vector<VkDescriptorBufferInfo> missBufferInfos[3] {
-			this->missBuffer->getBuffersInfo(),
-			this->indirectObjectHitRecordBuffer->getBuffersInfo(),
-			this->indirectLightHitRecordBuffer->getBuffersInfo()
+		std::vector<VkDescriptorBufferInfo> missBufferInfos[2] {
+			this->shadeBuffer->getBuffersInfo(),
+			this->indirectHitRecordBuffer->getBuffersInfo()
 		};
 
 		std::vector<VkDescriptorBufferInfo> indirectSamplerBufferInfos[3] {
-			this->objectRayDataBuffer->getBuffersInfo(),
-			this->lightRayDataBuffer->getBuffersInfo(),
-			this->indirectSamplerBuffer->getBuffersInfo()
+			this->rayDataBuffer->getBuffersInfo(),
+			this->indirectSamplerBuffer->getBuffersInfo(),
+			this->pixelStatisticsBuffer->getBuffersInfo()
 		};
 
 		std::vector<VkDescriptorBufferInfo> directSamplerBufferInfos[5] {
-			this->objectRayDataBuffer->getBuffersInfo(),
-			this->lightRayDataBuffer->getBuffersInfo(),
+			this->rayDataBuffer->getBuffersInfo(),
 			this->directDataBuffer->getBuffersInfo(),
-			this->indirectObjectHitRecordBuffer->getBuffersInfo(),
-			this->indirectLightHitRecordBuffer->getBuffersInfo()
+			this->indirectHitRecordBuffer->getBuffersInfo(),
+			this->rayQueueBuffer->getBuffersInfo(),
+			this->indirectSamplerBuffer->getBuffersInfo()
 		};
 
-		std::vector<VkDescriptorBufferInfo> sunDirectSamplerBufferInfos[5] {
-			this->objectRayDataBuffer->getBuffersInfo(),
-			this->lightRayDataBuffer->getBuffersInfo(),
+		std::vector<VkDescriptorBufferInfo> sunDirectSamplerBufferInfos[4] {
+			this->rayDataBuffer->getBuffersInfo(),
 			this->directDataBuffer->getBuffersInfo(),
-			this->indirectObjectHitRecordBuffer->getBuffersInfo(),
-			this->indirectLightHitRecordBuffer->getBuffersInfo()
+			this->indirectHitRecordBuffer->getBuffersInfo(),
+			this->rayQueueBuffer->getBuffersInfo()
+		};
+
+		VkDescriptorBufferInfo shadeModelInfos[3] {
+			this->materialModel->getMaterialInfo(),
+			this->lightModel->getLightInfo(),
+			this->rayTraceVertexModels->getVertexnfo()
 		};
 
 		VkDescriptorBufferInfo indirectShadeModelInfos[1] {
@@ -784,12 +984,6 @@ namespace nugiEngine {
 			this->materialModel->getMaterialInfo()
 		};
 
-		VkDescriptorBufferInfo intersectLightModelInfos[3] {
-			this->lightModel->getLightInfo(),
-			this->lightModel->getBvhInfo(),
-			this->rayTraceVertexModels->getVertexnfo()
-		};
-
 		VkDescriptorBufferInfo intersectObjectModelInfos[7] {
 			this->objectModel->getObjectInfo(),
 			this->objectModel->getBvhInfo(),
@@ -800,6 +994,44 @@ namespace nugiEngine {
 			this->transformationModel->getTransformationInfo()
 		};
 
+		VkDescriptorBufferInfo intersectShadowModelInfos[6] {
+			this->objectModel->getObjectInfo(),
+			this->objectModel->getBvhInfo(),
+			this->primitiveModel->getPrimitiveInfo(),
+			this->primitiveModel->getBvhInfo(),
+			this->rayTraceVertexModels->getVertexnfo(),
+			this->transformationModel->getTransformationInfo()
+		};
+
+		std::vector<VkDescriptorBufferInfo> adaptiveMaskBufferInfos[2] {
+			this->pixelStatisticsBuffer->getBuffersInfo(),
+			this->convergenceBuffer->getBuffersInfo()
+		};
+
+		std::vector<VkDescriptorBufferInfo> megakernelBufferInfos[2] {
+			this->pixelStatisticsBuffer->getBuffersInfo(),
+			this->workQueueBuffer->getBuffersInfo()
+		};
+
+		VkDescriptorBufferInfo megakernelModelInfos[8] {
+			this->objectModel->getObjectInfo(),
+			this->objectModel->getBvhInfo(),
+			this->primitiveModel->getPrimitiveInfo(),
+			this->primitiveModel->getBvhInfo(),
+			this->rayTraceVertexModels->getVertexnfo(),
+			this->materialModel->getMaterialInfo(),
+			this->transformationModel->getTransformationInfo(),
+			this->lightModel->getLightInfo()
+		};
+
+		VkDescriptorBufferInfo raySortModelInfos[1] {
+			this->objectModel->getBvhInfo()
+		};
+
+		VkDescriptorBufferInfo shadeSortModelInfos[1] {
+			this->materialModel->getMaterialInfo()
+		};
+
 		VkDescriptorBufferInfo lightShadeModelInfos[2] {
 			this->lightModel->getLightInfo(),
 			this->rayTraceVertexModels->getVertexnfo()
@@ -810,40 +1042,462 @@ namespace nugiEngine {
 			this->rayTraceVertexModels->getVertexnfo()
 		};
 
-		std::vector<VkDescriptorImageInfo> imagesInfo[2] {
-			this->indirectImage->getImagesInfo(),
-			this->accumulateImages->getImagesInfo()
+		std::vector<VkDescriptorBufferInfo> tonemapBufferInfos[2] {
+			this->pixelStatisticsBuffer->getBuffersInfo(),
+			this->getDenoisedBuffer()->getBuffersInfo()
 		};
 
+		this->shadeDescSet = std::make_unique<EngineShadeDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), shadeBufferInfos, shadeModelInfos);
 		this->indirectShadeDescSet = std::make_unique<EngineIndirectShadeDescSet>(this->device, this->renderer->getDescriptorPool(), indirectShadeBufferInfos, indirectShadeModelInfos);
-		this->directShadeDescSet = std::make_unique<EngineDirectShadeDescSet>(this->device, this->renderer->getDescriptorPool(), directShadeBufferInfos, directShadeModelInfos);
+		this->directShadeDescSet = std::make_unique<EngineDirectShadeDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), directShadeBufferInfos, directShadeModelInfos);
 		this->sunDirectShadeDescSet = std::make_unique<EngineSunDirectShadeDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), sunDirectShadeBufferInfos, sunDirectShadeModelInfos);
-		this->integratorDescSet = std::make_unique<EngineIntegratorDescSet>(this->device, this->renderer->getDescriptorPool(), this->indirectImage->getImagesInfo(), integratorBufferInfos);
-		this->directIntersectLightDescSet = std::make_unique<EngineIntersectLightDescSet>(this->device, this->renderer->getDescriptorPool(), directIntersectLightBufferInfos, intersectLightModelInfos);
-		this->directIntersectObjectDescSet = std::make_unique<EngineIntersectObjectDescSet>(this->device, this->renderer->getDescriptorPool(), directIntersectObjectBufferInfos, intersectObjectModelInfos);
-		this->indirectIntersectLightDescSet = std::make_unique<EngineIntersectLightDescSet>(this->device, this->renderer->getDescriptorPool(), indirectIntersectLightBufferInfos, intersectLightModelInfos);
+		this->integratorDescSet = std::make_unique<EngineIntegratorDescSet>(this->device, this->renderer->getDescriptorPool(), integratorBufferInfos);
 		this->indirectIntersectObjectDescSet = std::make_unique<EngineIntersectObjectDescSet>(this->device, this->renderer->getDescriptorPool(), indirectIntersectObjectBufferInfos, intersectObjectModelInfos);
-		this->lightShadeDescSet = std::make_unique<EngineLightShadeDescSet>(this->device, this->renderer->getDescriptorPool(), lightShadeBufferInfos, lightShadeModelInfos);
+		this->intersectShadowDescSet = std::make_unique<EngineIntersectShadowDescSet>(this->device, this->renderer->getDescriptorPool(), intersectShadowBufferInfos, intersectShadowModelInfos);
+		this->raySortDescSet = std::make_unique<EngineRaySortDescSet>(this->device, this->renderer->getDescriptorPool(), raySortBufferInfos, raySortModelInfos);
+		this->shadeSortDescSet = std::make_unique<EngineRaySortDescSet>(this->device, this->renderer->getDescriptorPool(), shadeSortBufferInfos, shadeSortModelInfos);
+		this->lightShadeDescSet = std::make_unique<EngineLightShadeDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), lightShadeBufferInfos, lightShadeModelInfos);
 		this->missDescSet = std::make_unique<EngineMissDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), missBufferInfos);
 		this->indirectSamplerDescSet = std::make_unique<EngineIndirectSamplerDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), indirectSamplerBufferInfos);
 		this->directSamplerDescSet = std::make_unique<EngineDirectSamplerDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), directSamplerBufferInfos, directSamplerModelInfos);
 		this->sunDirectSamplerDescSet = std::make_unique<EngineSunDirectSamplerDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), sunDirectSamplerBufferInfos);
-		this->samplingDescSet = std::make_unique<EngineSamplingDescSet>(this->device, this->renderer->getDescriptorPool(), imagesInfo);
-
-		this->indirectShadeRender = std::make_unique<EngineIndirectShadeRenderSystem>(this->device, this->indirectShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->directShadeRender = std::make_unique<EngineDirectShadeRenderSystem>(this->device, this->directShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->sunDirectShadeRender = std::make_unique<EngineSunDirectShadeRenderSystem>(this->device, this->sunDirectShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->integratorRender = std::make_unique<EngineIntegratorRenderSystem>(this->device, this->integratorDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->intersectLightRender = std::make_unique<EngineIntersectLightRenderSystem>(this->device, this->directIntersectLightDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->intersectObjectRender = std::make_unique<EngineIntersectObjectRenderSystem>(this->device, this->directIntersectObjectDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->lightShadeRender = std::make_unique<EngineLightShadeRenderSystem>(this->device, this->lightShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->missRender = std::make_unique<EngineMissRenderSystem>(this->device, this->missDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->indirectSamplerRender = std::make_unique<EngineIndirectSamplerRenderSystem>(this->device, this->indirectSamplerDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->directSamplerRender = std::make_unique<EngineDirectSamplerRenderSystem>(this->device, this->directSamplerDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->sunDirectSamplerRender = std::make_unique<EngineSunDirectSamplerRenderSystem>(this->device, this->sunDirectSamplerDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, 1u);
-		this->samplingRayRender = std::make_unique<EngineSamplingRayRasterRenderSystem>(this->device, this->samplingDescSet->getDescSetLayout()->getDescriptorSetLayout(), 
-			this->swapChainSubRenderer->getRenderPass()->getRenderPass());
+		this->megakernelDescSet = std::make_unique<EngineMegakernelDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), megakernelBufferInfos, megakernelModelInfos);
+		this->adaptiveMaskDescSet = std::make_unique<EngineAdaptiveMaskDescSet>(this->device, this->renderer->getDescriptorPool(), adaptiveMaskBufferInfos);
+		this->tonemapDescSet = std::make_unique<EngineTonemapDescSet>(this->device, this->renderer->getDescriptorPool(), this->indirectImage->getImagesInfo(), tonemapBufferInfos);
+
+		if (EngineApp::REPROJECT_HISTORY) {
+			std::vector<VkDescriptorBufferInfo> reprojectBufferInfos[4] {
+				this->pixelStatisticsBuffer->getBuffersInfo(),
+				this->pixelGuideBuffer->getBuffersInfo(),
+				this->historyStatisticsBuffer->getBuffersInfo(),
+				this->historyGuideBuffer->getBuffersInfo()
+			};
+
+			this->reprojectDescSet = std::make_unique<EngineReprojectDescSet>(this->device, this->renderer->getDescriptorPool(), this->globalUniforms->getBuffersInfo(), reprojectBufferInfos);
+		}
+
+		// The a-trous passes bounce between the two buffers, one set for each direction
+		if (EngineApp::DENOISE) {
+			std::vector<VkDescriptorBufferInfo> denoisePingPongBufferInfos[4] {
+				this->pixelStatisticsBuffer->getBuffersInfo(),
+				this->pixelGuideBuffer->getBuffersInfo(),
+				this->denoisePingBuffer->getBuffersInfo(),
+				this->denoisePongBuffer->getBuffersInfo()
+			};
+
+			std::vector<VkDescriptorBufferInfo> denoisePongPingBufferInfos[4] {
+				this->pixelStatisticsBuffer->getBuffersInfo(),
+				this->pixelGuideBuffer->getBuffersInfo(),
+				this->denoisePongBuffer->getBuffersInfo(),
+				this->denoisePingBuffer->getBuffersInfo()
+			};
+
+			this->denoisePingPongDescSet = std::make_unique<EngineDenoiseDescSet>(this->device, this->renderer->getDescriptorPool(), denoisePingPongBufferInfos);
+			this->denoisePongPingDescSet = std::make_unique<EngineDenoiseDescSet>(this->device, this->renderer->getDescriptorPool(), denoisePongPingBufferInfos);
+
+			std::vector<VkDescriptorBufferInfo> imageErrorBufferInfos[4] {
+				this->pixelStatisticsBuffer->getBuffersInfo(),
+				this->getDenoisedBuffer()->getBuffersInfo(),
+				this->qualityReferenceBuffer->getBuffersInfo(),
+				this->imageErrorBuffer->getBuffersInfo()
+			};
+
+			this->imageErrorDescSet = std::make_unique<EngineImageErrorDescSet>(this->device, this->renderer->getDescriptorPool(), imageErrorBufferInfos);
+		}
+
+		this->shadeRender = std::make_unique<EngineShadeRenderSystem>(this->device, this->shadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->indirectShadeRender = std::make_unique<EngineIndirectShadeRenderSystem>(this->device, this->indirectShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->directShadeRender = std::make_unique<EngineDirectShadeRenderSystem>(this->device, this->directShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->sunDirectShadeRender = std::make_unique<EngineSunDirectShadeRenderSystem>(this->device, this->sunDirectShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->integratorRender = std::make_unique<EngineIntegratorRenderSystem>(this->device, this->integratorDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->intersectObjectRender = std::make_unique<EngineIntersectObjectRenderSystem>(this->device, this->indirectIntersectObjectDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->intersectShadowRender = std::make_unique<EngineIntersectShadowRenderSystem>(this->device, this->intersectShadowDescSet->getDescSetLayout()->getDescriptorSetLayout(), this->kernelConfig);
+		this->raySortRender = std::make_unique<EngineRaySortRenderSystem>(this->device, this->raySortDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, "shader/ray_sort_key.comp.spv", this->kernelConfig);
+		this->shadeSortRender = std::make_unique<EngineRaySortRenderSystem>(this->device, this->shadeSortDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, "shader/shade_sort_key.comp.spv", this->kernelConfig);
+		this->lightShadeRender = std::make_unique<EngineLightShadeRenderSystem>(this->device, this->lightShadeDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->missRender = std::make_unique<EngineMissRenderSystem>(this->device, this->missDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->indirectSamplerRender = std::make_unique<EngineIndirectSamplerRenderSystem>(this->device, this->indirectSamplerDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->directSamplerRender = std::make_unique<EngineDirectSamplerRenderSystem>(this->device, this->directSamplerDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->sunDirectSamplerRender = std::make_unique<EngineSunDirectSamplerRenderSystem>(this->device, this->sunDirectSamplerDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig.samplesPerPixel, this->kernelConfig);
+		this->megakernelRender = std::make_unique<EngineMegakernelRenderSystem>(this->device, this->megakernelDescSet->getDescSetLayout()->getDescriptorSetLayout(), this->kernelConfig);
+		this->adaptiveMaskRender = std::make_unique<EngineAdaptiveMaskRenderSystem>(this->device, this->adaptiveMaskDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig);
+		this->tonemapRender = std::make_unique<EngineTonemapRenderSystem>(this->device, this->tonemapDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig);
+
+		if (EngineApp::REPROJECT_HISTORY) {
+			this->reprojectRender = std::make_unique<EngineReprojectRenderSystem>(this->device, this->reprojectDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig);
+		}
+
+		if (EngineApp::DENOISE) {
+			this->denoiseRender = std::make_unique<EngineDenoiseRenderSystem>(this->device, this->denoisePingPongDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig);
+			this->imageErrorRender = std::make_unique<EngineImageErrorRenderSystem>(this->device, this->imageErrorDescSet->getDescSetLayout()->getDescriptorSetLayout(), width, height, this->kernelConfig);
+		}
+
+		std::cout << "Workgroup size: " << this->kernelConfig.workGroupSize << ", traversal stack: " << this->kernelConfig.traversalStackSize << " shared and " 
+			<< this->kernelConfig.traversalSpillSize << " private entries, " 
+			<< traversalSharedMemorySize(this->kernelConfig) << " of " << this->device.getProperties().limits.maxComputeSharedMemorySize << " bytes of shared memory per workgroup\n";
+		std::cout << "Samples per pixel: " << this->kernelConfig.samplesPerPixel << ", " << numPaths << " paths in flight\n";
+		std::cout << "Subgroup size: " << this->device.getSubgroupProperties().subgroupSize << ", aggregated atomics " << (this->kernelConfig.isSubgroupOps ? "on" : "off, using the fallback kernels") << "\n";
 
 		this->camera = std::make_shared<EngineCamera>(width, height);
 	}
-}
\ No newline at end of file
+
+	// Every compute pass of a frame declares the buffers it touches, the graph turns that into the barriers between them
+	void EngineApp::buildComputeGraph() {
+		this->computeGraph = std::make_unique<EngineComputeGraph>();
+
+		// ----------- History -----------
+
+		// The statistics and guides of the last camera have to be saved before the restart below clears the statistics
+		// and the shade pass overwrites the guides
+		if (EngineApp::REPROJECT_HISTORY) {
+			this->computeGraph->addStage({ 
+					transferReadAccess(this->pixelStatisticsBuffer->getBuffersInfo()), transferReadAccess(this->pixelGuideBuffer->getBuffersInfo()), 
+					transferWriteAccess(this->historyStatisticsBuffer->getBuffersInfo()), transferWriteAccess(this->historyGuideBuffer->getBuffersInfo()) 
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					if (this->isReprojectFrame && this->bounceIndex == 0u) {
+						this->historyStatisticsBuffer->copyFrom(commandBuffer, frameIndex, this->pixelStatisticsBuffer->getBuffersInfo());
+						this->historyGuideBuffer->copyFrom(commandBuffer, frameIndex, this->pixelGuideBuffer->getBuffersInfo());
+					}
+				});
+		}
+
+		// ----------- Adaptive Mask -----------
+
+		// Only in the first bounce of a mask frame: a new accumulation resets the statistics, every ADAPTIVE_MASK_INTERVAL frames
+		// the mask is rebuilt. Either way the active pixels are counted for the render loop
+		this->computeGraph->addStage({ transferWriteAccess(this->convergenceBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				if (this->isMaskFrame && this->bounceIndex == 0u) {
+					this->convergenceBuffer->reset(commandBuffer, frameIndex);
+				}
+			});
+
+		this->computeGraph->addStage({ readWriteAccess(this->pixelStatisticsBuffer->getBuffersInfo()), readWriteAccess(this->convergenceBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				if (this->isMaskFrame && this->bounceIndex == 0u) {
+					this->adaptiveMaskRender->render(commandBuffer, this->adaptiveMaskDescSet->getDescriptorSets(frameIndex), this->randomSeed, 
+						EngineApp::ADAPTIVE_MIN_SAMPLES, EngineApp::ADAPTIVE_ERROR_THRESHOLD);
+					this->convergenceBuffer->transferToHost(commandBuffer, frameIndex);
+				}
+			});
+
+		// ----------- Indirect Sampler -----------
+
+		this->computeGraph->addStage({ readAccess(this->indirectSamplerBuffer->getBuffersInfo()), readAccess(this->pixelStatisticsBuffer->getBuffersInfo()), writeAccess(this->rayDataBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->indirectSamplerRender->render(commandBuffer, this->indirectSamplerDescSet->getDescriptorSets(frameIndex), this->randomSeed, 
+					this->isPrimaryRaySubmission());
+			});
+
+		// ----------- Ray Sort -----------
+
+		if (EngineApp::SORT_INDIRECT_RAYS) {
+			this->computeGraph->addStage({ transferWriteAccess(this->raySortBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->raySortBuffer->reset(commandBuffer, frameIndex);
+				});
+
+			// Right after a path restart every ray is primary and already coherent, so only the identity order is written
+			this->computeGraph->addStage({ readAccess(this->rayDataBuffer->getBuffersInfo()), readWriteAccess(this->raySortBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					if (!this->isPrimaryRaySubmission()) {
+						this->raySortRender->renderKey(commandBuffer, this->raySortDescSet->getDescriptorSets(frameIndex));
+					}
+				});
+
+			this->computeGraph->addStage({ readWriteAccess(this->raySortBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					if (!this->isPrimaryRaySubmission()) {
+						this->raySortRender->renderScan(commandBuffer, this->raySortDescSet->getDescriptorSets(frameIndex));
+					}
+				});
+
+			this->computeGraph->addStage({ readAccess(this->raySortBuffer->getBuffersInfo()), writeAccess(this->rayOrderBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->raySortRender->renderScatter(commandBuffer, this->raySortDescSet->getDescriptorSets(frameIndex), this->isPrimaryRaySubmission());
+				});
+		}
+
+		// ----------- Intersect Object -----------
+
+		// Unlike the shadow rays, the path stages below run over every slot. A path that ends restarts in its slot on the next
+		// bounce, so the only slots without a live ray belong to converged pixels, and their zero direction skips traversal.
+		// The integrator must visit every slot anyway to restart it, and the shade kernels read through the sort orders,
+		// which cover all slots. A queue would mostly hold every slot and add a count and an indirect dispatch per stage
+		this->computeGraph->addStage({ readAccess(this->rayDataBuffer->getBuffersInfo()), readAccess(this->rayOrderBuffer->getBuffersInfo()), writeAccess(this->indirectHitRecordBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->intersectObjectRender->render(commandBuffer, this->indirectIntersectObjectDescSet->getDescriptorSets(frameIndex));
+			});
+
+		// ----------- Shade Sort -----------
+
+		if (EngineApp::SORT_SHADE_HITS) {
+			this->computeGraph->addStage({ transferWriteAccess(this->raySortBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->raySortBuffer->reset(commandBuffer, frameIndex);
+				});
+
+			this->computeGraph->addStage({ readAccess(this->indirectHitRecordBuffer->getBuffersInfo()), readWriteAccess(this->raySortBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->shadeSortRender->renderKey(commandBuffer, this->shadeSortDescSet->getDescriptorSets(frameIndex));
+				});
+
+			this->computeGraph->addStage({ readWriteAccess(this->raySortBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->shadeSortRender->renderScan(commandBuffer, this->shadeSortDescSet->getDescriptorSets(frameIndex));
+				});
+
+			this->computeGraph->addStage({ readAccess(this->raySortBuffer->getBuffersInfo()), writeAccess(this->shadeOrderBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->shadeSortRender->renderScatter(commandBuffer, this->shadeSortDescSet->getDescriptorSets(frameIndex));
+				});
+		}
+
+		if (EngineApp::FUSE_SHADE_KERNELS) {
+			// ----------- Shade -----------
+
+			this->computeGraph->addStage({ 
+					readAccess(this->indirectHitRecordBuffer->getBuffersInfo()), readAccess(this->rayDataBuffer->getBuffersInfo()), 
+					readAccess(this->shadeOrderBuffer->getBuffersInfo()), readAccess(this->indirectSamplerBuffer->getBuffersInfo()), 
+					writeAccess(this->shadeBuffer->getBuffersInfo()), writeAccess(this->pixelGuideBuffer->getBuffersInfo()) 
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->shadeRender->render(commandBuffer, this->shadeDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				});
+		} else {
+			// ----------- Indirect Shade -----------
+
+			this->computeGraph->addStage({ 
+					readAccess(this->indirectHitRecordBuffer->getBuffersInfo()), readAccess(this->shadeOrderBuffer->getBuffersInfo()), 
+					readAccess(this->indirectSamplerBuffer->getBuffersInfo()), writeAccess(this->shadeBuffer->getBuffersInfo()) 
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->indirectShadeRender->render(commandBuffer, this->indirectShadeDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				});
+
+			// ----------- Light Shade -----------
+
+			this->computeGraph->addStage({ readAccess(this->indirectHitRecordBuffer->getBuffersInfo()), readAccess(this->rayDataBuffer->getBuffersInfo()), writeAccess(this->shadeBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->lightShadeRender->render(commandBuffer, this->lightShadeDescSet->getDescriptorSets(frameIndex));
+				});
+
+			// ----------- Miss -----------
+
+			this->computeGraph->addStage({ readAccess(this->indirectHitRecordBuffer->getBuffersInfo()), writeAccess(this->shadeBuffer->getBuffersInfo()) }, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->missRender->render(commandBuffer, this->missDescSet->getDescriptorSets(frameIndex));
+				});
+		}
+
+		// ----------- Reproject -----------
+
+		// Every path restarted in the first bounce, so by now each pixel's guide holds its first hit from the new camera
+		if (EngineApp::REPROJECT_HISTORY) {
+			this->computeGraph->addStage({ 
+					readAccess(this->pixelGuideBuffer->getBuffersInfo()), readAccess(this->historyStatisticsBuffer->getBuffersInfo()), 
+					readAccess(this->historyGuideBuffer->getBuffersInfo()), readWriteAccess(this->pixelStatisticsBuffer->getBuffersInfo()) 
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					if (this->isReprojectFrame && this->bounceIndex == 0u) {
+						this->reprojectRender->render(commandBuffer, this->reprojectDescSet->getDescriptorSets(frameIndex), EngineApp::REPROJECT_MAX_HISTORY);
+					}
+				});
+		}
+
+		// ----------- Direct Light -----------
+
+		if (this->hasAreaLight) {
+			this->addDirectLightStages(this->directShadeShadeBuffer, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->directSamplerRender->render(commandBuffer, this->directSamplerDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->directShadeRender->render(commandBuffer, this->directShadeDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				});
+		}
+
+		// ----------- Sun Direct Light -----------
+
+		if (this->hasSunLight) {
+			this->addDirectLightStages(this->sunDirectShadeShadeBuffer, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->sunDirectSamplerRender->render(commandBuffer, this->sunDirectSamplerDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					this->sunDirectShadeRender->render(commandBuffer, this->sunDirectShadeDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+				});
+		}
+
+		// ----------- Integrator -----------
+
+		std::vector<EngineGraphAccess> integratorAccesses { 
+			readWriteAccess(this->indirectSamplerBuffer->getBuffersInfo()), readWriteAccess(this->indirectDataBuffer->getBuffersInfo()), readAccess(this->shadeBuffer->getBuffersInfo()), 
+			readWriteAccess(this->pixelStatisticsBuffer->getBuffersInfo())
+		};
+
+		if (this->hasAreaLight) {
+			integratorAccesses.emplace_back(readAccess(this->directShadeShadeBuffer->getBuffersInfo()));
+		}
+
+		if (this->hasSunLight) {
+			integratorAccesses.emplace_back(readAccess(this->sunDirectShadeShadeBuffer->getBuffersInfo()));
+		}
+
+		this->computeGraph->addStage(integratorAccesses, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->integratorRender->render(commandBuffer, this->integratorDescSet->getDescriptorSets(frameIndex), this->randomSeed, 
+					this->bounceIndex + 1 == EngineApp::BOUNCES_PER_SUBMISSION, this->isPrimaryRaySubmission());
+			});
+
+		// ----------- Denoise -----------
+
+		// After the last bounce of a submission: the running mean is demodulated into the ping buffer, then every a-trous pass
+		// doubles its step and swaps the buffers. The last one multiplies the albedo back in for the tonemap
+		if (EngineApp::DENOISE) {
+			this->computeGraph->addStage({ 
+					readAccess(this->pixelStatisticsBuffer->getBuffersInfo()), readAccess(this->pixelGuideBuffer->getBuffersInfo()), 
+					writeAccess(this->denoisePingBuffer->getBuffersInfo()) 
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					if (this->isDenoiseFrame && this->bounceIndex + 1 == EngineApp::BOUNCES_PER_SUBMISSION) {
+						this->denoiseRender->renderDemodulate(commandBuffer, this->denoisePongPingDescSet->getDescriptorSets(frameIndex));
+					}
+				});
+
+			for (uint32_t i = 0; i < EngineApp::DENOISE_ITERATIONS; i++) {
+				bool isPingToPong = i % 2u == 0u;
+				auto inputBuffer = isPingToPong ? this->denoisePingBuffer : this->denoisePongBuffer;
+				auto outputBuffer = isPingToPong ? this->denoisePongBuffer : this->denoisePingBuffer;
+
+				this->computeGraph->addStage({ 
+						readAccess(this->pixelGuideBuffer->getBuffersInfo()), readAccess(inputBuffer->getBuffersInfo()), 
+						writeAccess(outputBuffer->getBuffersInfo()) 
+					}, 
+					[this, i, isPingToPong](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+						if (this->isDenoiseFrame && this->bounceIndex + 1 == EngineApp::BOUNCES_PER_SUBMISSION) {
+							auto descSet = isPingToPong ? this->denoisePingPongDescSet.get() : this->denoisePongPingDescSet.get();
+							this->denoiseRender->renderAtrous(commandBuffer, descSet->getDescriptorSets(frameIndex), 1u << i, i + 1u == EngineApp::DENOISE_ITERATIONS);
+						}
+					});
+			}
+
+			// Only in the frames of a quality run that capture the reference or measure against it
+			this->computeGraph->addStage({ 
+					readAccess(this->pixelStatisticsBuffer->getBuffersInfo()), readAccess(this->getDenoisedBuffer()->getBuffersInfo()), 
+					readWriteAccess(this->qualityReferenceBuffer->getBuffersInfo()), writeAccess(this->imageErrorBuffer->getBuffersInfo()) 
+				}, 
+				[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+					if (this->isQualityFrame && this->bounceIndex + 1 == EngineApp::BOUNCES_PER_SUBMISSION) {
+						this->imageErrorRender->render(commandBuffer, this->imageErrorDescSet->getDescriptorSets(frameIndex), this->qualityPhase == QualityPhase::Reference, this->isDenoiseFrame);
+						this->imageErrorBuffer->transferToHost(commandBuffer, frameIndex);
+					}
+				});
+		}
+
+		// ----------- Tonemap -----------
+
+		// Once per submission, from the denoised radiance on a denoise frame and from the running mean otherwise
+		std::vector<EngineGraphAccess> tonemapAccesses { readAccess(this->pixelStatisticsBuffer->getBuffersInfo()) };
+		if (EngineApp::DENOISE) {
+			tonemapAccesses.emplace_back(readAccess(this->getDenoisedBuffer()->getBuffersInfo()));
+		}
+
+		this->computeGraph->addOutputStage(tonemapAccesses, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				if (this->bounceIndex + 1 == EngineApp::BOUNCES_PER_SUBMISSION) {
+					this->tonemapRender->render(commandBuffer, this->tonemapDescSet->getDescriptorSets(frameIndex), this->isDenoiseFrame, EngineApp::TONEMAP_EXPOSURE);
+				}
+			});
+
+		// The path state and the pixel statistics are what the next frame starts from
+		this->computeGraph->markOutput(this->indirectSamplerBuffer->getBuffersInfo());
+		this->computeGraph->markOutput(this->indirectDataBuffer->getBuffersInfo());
+		this->computeGraph->markOutput(this->pixelStatisticsBuffer->getBuffersInfo());
+		this->computeGraph->markOutput(this->convergenceBuffer->getBuffersInfo());
+		this->computeGraph->markOutput(this->pixelGuideBuffer->getBuffersInfo());
+
+		if (EngineApp::DENOISE) {
+			this->computeGraph->markOutput(this->qualityReferenceBuffer->getBuffersInfo());
+			this->computeGraph->markOutput(this->imageErrorBuffer->getBuffersInfo());
+		}
+
+		this->computeGraph->compile(this->transientAllocator.get());
+	}
+
+	// The a-trous passes alternate between the two buffers, the last one leaves its result in this one
+	std::shared_ptr<EngineDenoiseStorageBuffer> EngineApp::getDenoisedBuffer() const {
+		return EngineApp::DENOISE_ITERATIONS % 2u == 0u ? this->denoisePingBuffer : this->denoisePongBuffer;
+	}
+
+	// The first submission after a restart is the only one where every path slot holds a primary ray
+	bool EngineApp::isPrimaryRaySubmission() const {
+		return this->randomSeed == 0u && this->bounceIndex == 0u;
+	}
+
+	// Both direct light passes share the queue, visibility and direct data buffers, only their sampler and shade kernels differ
+	void EngineApp::addDirectLightStages(std::shared_ptr<EngineDirectShadeStorageBuffer> shadeBuffer, EngineComputeGraph::RecordFunction renderSampler, 
+		EngineComputeGraph::RecordFunction renderShade) 
+	{
+		this->computeGraph->addStage({ transferWriteAccess(this->rayQueueBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->rayQueueBuffer->reset(commandBuffer, frameIndex);
+			});
+
+		this->computeGraph->addStage({ 
+				readAccess(this->indirectHitRecordBuffer->getBuffersInfo()), 
+				readAccess(this->indirectSamplerBuffer->getBuffersInfo()), 
+				writeAccess(this->rayDataBuffer->getBuffersInfo()), 
+				writeAccess(this->directDataBuffer->getBuffersInfo()), 
+				readWriteAccess(this->rayQueueBuffer->getBuffersInfo()) 
+			}, 
+			renderSampler);
+
+		this->computeGraph->addStage({ transferWriteAccess(this->visibilityBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->visibilityBuffer->clear(commandBuffer, frameIndex);
+			});
+
+		this->computeGraph->addStage({ 
+				readAccess(this->rayQueueBuffer->getBuffersInfo()), 
+				indirectAccess(this->rayQueueBuffer->getBuffersInfo()), 
+				readAccess(this->rayDataBuffer->getBuffersInfo()), 
+				readWriteAccess(this->visibilityBuffer->getBuffersInfo()) 
+			}, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->intersectShadowRender->render(commandBuffer, this->intersectShadowDescSet->getDescriptorSets(frameIndex), this->rayQueueBuffer->getBuffer(frameIndex));
+			});
+
+		this->computeGraph->addStage({ 
+				readAccess(this->visibilityBuffer->getBuffersInfo()), 
+				readAccess(this->directDataBuffer->getBuffersInfo()), 
+				readAccess(this->shadeOrderBuffer->getBuffersInfo()), 
+				writeAccess(shadeBuffer->getBuffersInfo()) 
+			}, 
+			renderShade);
+	}
+
+	// The whole path lives in one kernel, so the only other stages are handing out the pixels again and the tonemap
+	void EngineApp::buildMegakernelGraph() {
+		this->megakernelGraph = std::make_unique<EngineComputeGraph>();
+
+		this->megakernelGraph->addStage({ transferWriteAccess(this->workQueueBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->workQueueBuffer->reset(commandBuffer, frameIndex);
+			});
+
+		this->megakernelGraph->addStage({ readWriteAccess(this->workQueueBuffer->getBuffersInfo()), readWriteAccess(this->pixelStatisticsBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->megakernelRender->render(commandBuffer, this->megakernelDescSet->getDescriptorSets(frameIndex), this->randomSeed);
+			});
+
+		this->megakernelGraph->addOutputStage({ readAccess(this->pixelStatisticsBuffer->getBuffersInfo()) }, 
+			[this](std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+				this->tonemapRender->render(commandBuffer, this->tonemapDescSet->getDescriptorSets(frameIndex), false, EngineApp::TONEMAP_EXPOSURE);
+			});
+
+		this->megakernelGraph->markOutput(this->pixelStatisticsBuffer->getBuffersInfo());
+		this->megakernelGraph->compile(this->transientAllocator.get());
+	}
+}
@@ -4,8 +4,9 @@
 #include "../../vulkan/device/device.hpp"
 #include "../../vulkan/texture/texture.hpp"
 #include "../../vulkan/buffer/buffer.hpp"
+#include "../../vulkan/buffer/transient_allocator.hpp"
 #include "../utils/camera/camera.hpp"
-#include "../data/image/accumulate_image.hpp"
+#include "../utils/kernel/kernel_config.hpp"
 #include "../data/image/ray_trace_image.hpp"
 #include "../data/model/primitive_model.hpp"
 #include "../data/model/object_model.hpp"
@@ -15,40 +16,62 @@
 #include "../data/model/vertex_ray_trace_model.hpp"
 #include "../data/buffer/global_uniform.hpp"
 #include "../data/buffer/storage/hit_record_storage_buffer.hpp"
-#include "../data/buffer/storage/indirect_shade_storage_buffer.hpp"
-#include "../data/buffer/storage/light_shade_storage_buffer.hpp"
-#include "../data/buffer/storage/miss_record_storage_buffer.hpp"
+#include "../data/buffer/storage/shade_storage_buffer.hpp"
 #include "../data/buffer/storage/ray_data_storage_buffer.hpp"
 #include "../data/buffer/storage/indirect_sampler_storage_buffer.hpp"
 #include "../data/buffer/storage/indirect_data_storage_buffer.hpp"
 #include "../data/buffer/storage/direct_shade_storage_buffer.hpp"
 #include "../data/buffer/storage/direct_data_storage_buffer.hpp"
+#include "../data/buffer/storage/visibility_storage_buffer.hpp"
+#include "../data/buffer/storage/ray_queue_storage_buffer.hpp"
+#include "../data/buffer/storage/ray_sort_storage_buffer.hpp"
+#include "../data/buffer/storage/ray_order_storage_buffer.hpp"
+#include "../data/buffer/storage/work_queue_storage_buffer.hpp"
+#include "../data/buffer/storage/pixel_statistics_storage_buffer.hpp"
+#include "../data/buffer/storage/convergence_storage_buffer.hpp"
+#include "../data/buffer/storage/pixel_guide_storage_buffer.hpp"
+#include "../data/buffer/storage/denoise_storage_buffer.hpp"
+#include "../data/buffer/storage/image_error_storage_buffer.hpp"
+#include "../data/descSet/ray_tracing/shade_desc_set.hpp"
 #include "../data/descSet/ray_tracing/indirect_shade_desc_set.hpp"
 #include "../data/descSet/ray_tracing/direct_shade_desc_set.hpp"
 #include "../data/descSet/ray_tracing/sun_direct_shade_desc_set.hpp"
 #include "../data/descSet/ray_tracing/integrator_desc_set.hpp"
-#include "../data/descSet/ray_tracing/intersect_light_desc_set.hpp"
 #include "../data/descSet/ray_tracing/intersect_object_desc_set.hpp"
+#include "../data/descSet/ray_tracing/intersect_shadow_desc_set.hpp"
+#include "../data/descSet/ray_tracing/ray_sort_desc_set.hpp"
 #include "../data/descSet/ray_tracing/light_shade_desc_set.hpp"
 #include "../data/descSet/ray_tracing/miss_desc_set.hpp"
 #include "../data/descSet/ray_tracing/indirect_sampler_desc_set.hpp"
 #include "../data/descSet/ray_tracing/direct_sampler_desc_set.hpp"
 #include "../data/descSet/ray_tracing/sun_direct_sampler_desc_set.hpp"
-#include "../data/descSet/sampling_desc_set.hpp"
+#include "../data/descSet/ray_tracing/megakernel_desc_set.hpp"
+#include "../data/descSet/ray_tracing/adaptive_mask_desc_set.hpp"
+#include "../data/descSet/ray_tracing/denoise_desc_set.hpp"
+#include "../data/descSet/ray_tracing/reproject_desc_set.hpp"
+#include "../data/descSet/ray_tracing/tonemap_desc_set.hpp"
+#include "../data/descSet/ray_tracing/image_error_desc_set.hpp"
 #include "../renderer/hybrid_renderer.hpp"
-#include "../renderer_sub/swapchain_sub_renderer.hpp"
+#include "../render_graph/compute_graph.hpp"
+#include "../renderer_system/ray_tracing/shade_render_system.hpp"
 #include "../renderer_system/ray_tracing/indirect_shade_render_system.hpp"
 #include "../renderer_system/ray_tracing/direct_shade_render_system.hpp"
 #include "../renderer_system/ray_tracing/sun_direct_shade_render_system.hpp"
 #include "../renderer_system/ray_tracing/integrator_render_system.hpp"
-#include "../renderer_system/ray_tracing/intersect_light_render_system.hpp"
 #include "../renderer_system/ray_tracing/intersect_object_render_system.hpp"
+#include "../renderer_system/ray_tracing/intersect_shadow_render_system.hpp"
+#include "../renderer_system/ray_tracing/ray_sort_render_system.hpp"
 #include "../renderer_system/ray_tracing/light_shade_render_system.hpp"
 #include "../renderer_system/ray_tracing/miss_render_system.hpp"
 #include "../renderer_system/ray_tracing/indirect_sampler_render_system.hpp"
 #include "../renderer_system/ray_tracing/direct_sampler_render_system.hpp"
 #include "../renderer_system/ray_tracing/sun_direct_sampler_render_system.hpp"
-#include "../renderer_system/sampling_ray_raster_render_system.hpp"
+#include "../renderer_system/ray_tracing/megakernel_render_system.hpp"
+#include "../renderer_system/ray_tracing/adaptive_mask_render_system.hpp"
+#include "../renderer_system/ray_tracing/denoise_render_system.hpp"
+#include "../renderer_system/ray_tracing/reproject_render_system.hpp"
+#include "../renderer_system/ray_tracing/tonemap_render_system.hpp"
+#include "../renderer_system/ray_tracing/image_error_render_system.hpp"
 #include "../utils/load_model/load_model.hpp"
 #include "../utils/camera/camera.hpp"
 #include "../controller/keyboard/keyboard_controller.hpp"
@@ -56,6 +79,10 @@
 
 #include <memory>
 #include <vector>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
 
 #define APP_TITLE "Testing Vulkan"
 
@@ -66,6 +93,86 @@ namespace nugiEngine {
 			static constexpr int WIDTH = 800;
 			static constexpr int HEIGHT = 800;
 
+			// Reorder secondary rays by direction octant and origin cell before tracing them. Off by default, 
+			// primary rays already come out of the sampler in Morton pixel order and the sort only pays off 
+			// for scenes big enough that incoherent bounces thrash the BVH in cache
+			static constexpr bool SORT_INDIRECT_RAYS = false;
+
+			// Keep the traversal stacks in shared memory, spilling only what the tallest BVH needs past them.
+			// Off keeps them whole in private memory, to compare occupancy and ray rates against
+			static constexpr bool SHARED_TRAVERSAL_STACK = true;
+
+			// Group hits by material before the shading kernels run
+			static constexpr bool SORT_SHADE_HITS = true;
+
+			// Classify and shade every hit in one kernel. The split miss, light and indirect shade kernels stay as a debug mode
+			static constexpr bool FUSE_SHADE_KERNELS = true;
+
+			// Skip triangles facing away from the ray in every traversal. Only safe for closed meshes
+			static constexpr bool BACKFACE_CULLING = false;
+
+			// Longest path either render mode traces before the pixel is written out
+			static constexpr uint32_t MAX_BOUNCE = 32u;
+
+			// First bounce a path can be ended by Russian roulette, earlier bounces only stop when nothing is reflected
+			static constexpr uint32_t ROULETTE_START_BOUNCE = 3u;
+
+			// SOBOL_SAMPLE_SEQUENCE scrambles every pixel on its own, BLUE_NOISE_SAMPLE_SEQUENCE spreads the error as blue noise across the screen
+			static constexpr uint32_t SAMPLE_SEQUENCE = SOBOL_SAMPLE_SEQUENCE;
+
+			// Paths traced for every pixel in each frame of the wavefront mode. Keeps the GPU busy at low resolutions
+			static constexpr uint32_t SAMPLES_PER_PIXEL = 4u;
+			static_assert((SAMPLES_PER_PIXEL & (SAMPLES_PER_PIXEL - 1u)) == 0u, "Samples per pixel must be a power of two");
+
+			// Wavefront bounces recorded into one command buffer before the frame is presented. MAX_BOUNCE lets every path
+			// started in a frame finish before it is shown, for offline and benchmark runs
+			static constexpr uint32_t BOUNCES_PER_SUBMISSION = 4u;
+
+			// Stop starting paths in pixels whose mean luminance is known to within ADAPTIVE_ERROR_THRESHOLD relative standard
+			// error. The mask is rebuilt every ADAPTIVE_MASK_INTERVAL frames, after a pixel has at least ADAPTIVE_MIN_SAMPLES paths
+			static constexpr bool ADAPTIVE_SAMPLING = true;
+			static constexpr uint32_t ADAPTIVE_MASK_INTERVAL = 16u;
+			static constexpr uint32_t ADAPTIVE_MIN_SAMPLES = 64u;
+			static constexpr float ADAPTIVE_ERROR_THRESHOLD = 0.02f;
+
+			// Rendering stops once the image is done: when the mask leaves no pixel active, or after this many frames without a
+			// camera or render mode change. The megakernel mode has no mask and only stops at the frame budget
+			static constexpr uint32_t MAX_ACCUMULATED_FRAMES = 4096u;
+
+			// Filter the wavefront image with DENOISE_ITERATIONS edge-avoiding a-trous passes guided by the first hit's normal,
+			// depth and albedo. Only the fused shade kernel writes those guides. The toggle key shows the raw image instead
+			static constexpr bool DENOISE = true;
+			static constexpr uint32_t DENOISE_ITERATIONS = 5u;
+			static constexpr int TOGGLE_DENOISE_KEY = GLFW_KEY_N;
+			static_assert(!DENOISE || FUSE_SHADE_KERNELS, "The denoiser needs the guides of the fused shade kernel");
+
+			// Once the wavefront image has converged, the quality key keeps it as the reference and restarts the accumulation twice,
+			// raw and then denoised. Both are compared against the reference after QUALITY_TIME_BUDGET seconds each, so what the
+			// filter costs shows up as fewer samples in the denoised run
+			static constexpr int MEASURE_QUALITY_KEY = GLFW_KEY_Q;
+			static constexpr float QUALITY_TIME_BUDGET = 2.0f;
+
+			// Keep the accumulated samples of surfaces still in view after the camera moves, found through the first hit's
+			// depth and normal. A pixel takes over at most REPROJECT_MAX_HISTORY samples, so stale shading fades out quickly
+			static constexpr bool REPROJECT_HISTORY = true;
+			static constexpr uint32_t REPROJECT_MAX_HISTORY = 32u;
+			static_assert(!REPROJECT_HISTORY || FUSE_SHADE_KERNELS, "Reprojection needs the guides of the fused shade kernel");
+
+			// Both modes accumulate into the float pixel statistics, the tonemap pass scales them by this exposure before the
+			// filmic curve and the sRGB encoding, then the result is copied into the swapchain image
+			static constexpr float TONEMAP_EXPOSURE = 1.0f;
+
+			// Wavefront takes every path BOUNCES_PER_SUBMISSION bounces further per frame, megakernel traces whole paths in one persistent-threads kernel
+			enum class RenderMode : uint32_t {
+				Wavefront = 0,
+				Megakernel,
+				Count
+			};
+
+			// Mode the app starts in, the toggle key switches between them while running
+			static constexpr RenderMode DEFAULT_RENDER_MODE = RenderMode::Wavefront;
+			static constexpr int TOGGLE_RENDER_MODE_KEY = GLFW_KEY_M;
+
 			EngineApp();
 			~EngineApp();
 
@@ -75,80 +182,169 @@ namespace nugiEngine {
 		private:
 			void loadCornellBox();
 			void loadSkyLight();
-			void loadQuadModels();
 
 			RayTraceUbo initUbo(uint32_t width, uint32_t height);
 			void recreateSubRendererAndSubsystem();
 
+			void resumeRendering();
+			void waitForResume();
+
+			void buildComputeGraph();
+			void buildMegakernelGraph();
+			void printBenchmark();
+			std::shared_ptr<EngineDenoiseStorageBuffer> getDenoisedBuffer() const;
+			void advanceQualityPhase();
+			void reportImageError(ImageError imageError);
+			bool isPrimaryRaySubmission() const;
+			void addDirectLightStages(std::shared_ptr<EngineDirectShadeStorageBuffer> shadeBuffer, EngineComputeGraph::RecordFunction renderSampler, 
+				EngineComputeGraph::RecordFunction renderShade);
+
 			EngineWindow window{WIDTH, HEIGHT, APP_TITLE};
 			EngineDevice device{window};
 			
 			std::unique_ptr<EngineHybridRenderer> renderer{};
-			std::unique_ptr<EngineSwapChainSubRenderer> swapChainSubRenderer{};
 
+			std::unique_ptr<EngineShadeRenderSystem> shadeRender{};
 			std::unique_ptr<EngineIndirectShadeRenderSystem> indirectShadeRender{};
 			std::unique_ptr<EngineDirectShadeRenderSystem> directShadeRender{};
 			std::unique_ptr<EngineSunDirectShadeRenderSystem> sunDirectShadeRender{};
 			std::unique_ptr<EngineIntegratorRenderSystem> integratorRender{};
 			std::unique_ptr<EngineIntersectObjectRenderSystem> intersectObjectRender{};
-			std::unique_ptr<EngineIntersectLightRenderSystem> intersectLightRender{};
+			std::unique_ptr<EngineIntersectShadowRenderSystem> intersectShadowRender{};
+			std::unique_ptr<EngineRaySortRenderSystem> raySortRender{};
+			std::unique_ptr<EngineRaySortRenderSystem> shadeSortRender{};
 			std::unique_ptr<EngineLightShadeRenderSystem> lightShadeRender{};
 			std::unique_ptr<EngineMissRenderSystem> missRender{};
 			std::unique_ptr<EngineIndirectSamplerRenderSystem> indirectSamplerRender{};
 			std::unique_ptr<EngineDirectSamplerRenderSystem> directSamplerRender{};
 			std::unique_ptr<EngineSunDirectSamplerRenderSystem> sunDirectSamplerRender{};
-			std::unique_ptr<EngineSamplingRayRasterRenderSystem> samplingRayRender{};
+			std::unique_ptr<EngineMegakernelRenderSystem> megakernelRender{};
+			std::unique_ptr<EngineAdaptiveMaskRenderSystem> adaptiveMaskRender{};
+			std::unique_ptr<EngineDenoiseRenderSystem> denoiseRender{};
+			std::unique_ptr<EngineReprojectRenderSystem> reprojectRender{};
+			std::unique_ptr<EngineTonemapRenderSystem> tonemapRender{};
+			std::unique_ptr<EngineImageErrorRenderSystem> imageErrorRender{};
 
-			std::unique_ptr<EngineAccumulateImage> accumulateImages{};
 			std::unique_ptr<EngineRayTraceImage> indirectImage{};
 			std::unique_ptr<EngineGlobalUniform> globalUniforms{};
+			std::unique_ptr<EngineTransientAllocator> transientAllocator{};
+			std::unique_ptr<EngineComputeGraph> computeGraph{};
+			std::unique_ptr<EngineComputeGraph> megakernelGraph{};
 
 			std::unique_ptr<EnginePrimitiveModel> primitiveModel{};
 			std::unique_ptr<EngineObjectModel> objectModel{};
 			std::unique_ptr<EngineLightModel> lightModel{};
 			std::unique_ptr<EngineMaterialModel> materialModel{};
 			std::unique_ptr<EngineTransformationModel> transformationModel{};
-			std::shared_ptr<EngineVertexModel> quadModels{};
 			std::shared_ptr<EngineRayTraceVertexModel> rayTraceVertexModels{};
 
-			std::shared_ptr<EngineRayDataStorageBuffer> objectRayDataBuffer{};
-			std::shared_ptr<EngineRayDataStorageBuffer> lightRayDataBuffer{};
-			std::shared_ptr<EngineHitRecordStorageBuffer> directObjectHitRecordBuffer{};
-			std::shared_ptr<EngineHitRecordStorageBuffer> directLightHitRecordBuffer{};
-			std::shared_ptr<EngineHitRecordStorageBuffer> indirectObjectHitRecordBuffer{};
-			std::shared_ptr<EngineHitRecordStorageBuffer> indirectLightHitRecordBuffer{};
-			std::shared_ptr<EngineIndirectShadeStorageBuffer> indirectShadeShadeBuffer{};
+			std::shared_ptr<EngineRayDataStorageBuffer> rayDataBuffer{};
+			std::shared_ptr<EngineHitRecordStorageBuffer> indirectHitRecordBuffer{};
+			std::shared_ptr<EngineShadeStorageBuffer> shadeBuffer{};
 			std::shared_ptr<EngineDirectShadeStorageBuffer> directShadeShadeBuffer{};
 			std::shared_ptr<EngineDirectShadeStorageBuffer> sunDirectShadeShadeBuffer{};
-			std::shared_ptr<EngineLightShadeStorageBuffer> lightShadeBuffer{};
-			std::shared_ptr<EngineMissRecordStorageBuffer> missBuffer{};
 			std::shared_ptr<EngineIndirectSamplerStorageBuffer> indirectSamplerBuffer{};
 			std::shared_ptr<EngineIndirectDataStorageBuffer> indirectDataBuffer{};
 			std::shared_ptr<EngineDirectDataStorageBuffer> directDataBuffer{};
+			std::shared_ptr<EngineVisibilityStorageBuffer> visibilityBuffer{};
+			std::shared_ptr<EngineRayQueueStorageBuffer> rayQueueBuffer{};
+			std::shared_ptr<EngineRaySortStorageBuffer> raySortBuffer{};
+			std::shared_ptr<EngineRayOrderStorageBuffer> rayOrderBuffer{};
+			std::shared_ptr<EngineRayOrderStorageBuffer> shadeOrderBuffer{};
+			std::shared_ptr<EngineWorkQueueStorageBuffer> workQueueBuffer{};
+			std::shared_ptr<EnginePixelStatisticsStorageBuffer> pixelStatisticsBuffer{};
+			std::shared_ptr<EngineConvergenceStorageBuffer> convergenceBuffer{};
+			std::shared_ptr<EnginePixelGuideStorageBuffer> pixelGuideBuffer{};
+			std::shared_ptr<EngineDenoiseStorageBuffer> denoisePingBuffer{};
+			std::shared_ptr<EngineDenoiseStorageBuffer> denoisePongBuffer{};
+			std::shared_ptr<EnginePixelStatisticsStorageBuffer> historyStatisticsBuffer{};
+			std::shared_ptr<EnginePixelGuideStorageBuffer> historyGuideBuffer{};
+			std::shared_ptr<EngineDenoiseStorageBuffer> qualityReferenceBuffer{};
+			std::shared_ptr<EngineImageErrorStorageBuffer> imageErrorBuffer{};
 
+			std::unique_ptr<EngineShadeDescSet> shadeDescSet{};
 			std::unique_ptr<EngineIndirectShadeDescSet> indirectShadeDescSet{};
 			std::unique_ptr<EngineDirectShadeDescSet> directShadeDescSet{};
 			std::unique_ptr<EngineSunDirectShadeDescSet> sunDirectShadeDescSet{};
 			std::unique_ptr<EngineIntegratorDescSet> integratorDescSet{};
-			std::unique_ptr<EngineIntersectObjectDescSet> directIntersectObjectDescSet{};
-			std::unique_ptr<EngineIntersectLightDescSet> directIntersectLightDescSet{};
 			std::unique_ptr<EngineIntersectObjectDescSet> indirectIntersectObjectDescSet{};
-			std::unique_ptr<EngineIntersectLightDescSet> indirectIntersectLightDescSet{};
+			std::unique_ptr<EngineIntersectShadowDescSet> intersectShadowDescSet{};
+			std::unique_ptr<EngineRaySortDescSet> raySortDescSet{};
+			std::unique_ptr<EngineRaySortDescSet> shadeSortDescSet{};
 			std::unique_ptr<EngineLightShadeDescSet> lightShadeDescSet{};
 			std::unique_ptr<EngineMissDescSet> missDescSet{};
 			std::unique_ptr<EngineIndirectSamplerDescSet> indirectSamplerDescSet{};
 			std::unique_ptr<EngineDirectSamplerDescSet> directSamplerDescSet{};
 			std::unique_ptr<EngineSunDirectSamplerDescSet> sunDirectSamplerDescSet{};
-			std::unique_ptr<EngineSamplingDescSet> samplingDescSet{};
+			std::unique_ptr<EngineMegakernelDescSet> megakernelDescSet{};
+			std::unique_ptr<EngineAdaptiveMaskDescSet> adaptiveMaskDescSet{};
+			std::unique_ptr<EngineDenoiseDescSet> denoisePingPongDescSet{};
+			std::unique_ptr<EngineDenoiseDescSet> denoisePongPingDescSet{};
+			std::unique_ptr<EngineReprojectDescSet> reprojectDescSet{};
+			std::unique_ptr<EngineTonemapDescSet> tonemapDescSet{};
+			std::unique_ptr<EngineImageErrorDescSet> imageErrorDescSet{};
 
 			std::shared_ptr<EngineCamera> camera{};
 			std::shared_ptr<EngineKeyboardController> keyboardController{};
 			std::shared_ptr<EngineMouseController> mouseController{};
 
 			uint32_t randomSeed = 0, numLights = 0;
-			bool isRendering = true, isCameraMoved = false;
-			float frameTime = 0;
+			uint32_t bounceIndex = 0;
+			std::atomic<bool> isRendering{true}, isCameraMoved{false};
+
+			// Whether this frame rebuilds the adaptive mask, and whether a count written by the last frame is still to be read
+			bool isMaskFrame = false, isMaskCountPending = false;
+			uint32_t activePixelCount = 0;
+
+			// Flipped by the toggle key on the main thread, read once per frame by the render thread
+			std::atomic<bool> isDenoising{EngineApp::DENOISE};
+			bool isDenoiseFrame = false;
+
+			// Steps of a quality run. The reference is captured in one frame, each timed phase starts over from an empty
+			// accumulation and is measured in its first frame past the budget
+			enum class QualityPhase : uint32_t {
+				Idle = 0,
+				Reference,
+				Raw,
+				Denoised
+			};
+
+			// The main thread raises the request on the quality key, the render thread runs the phases. Like the mask count, 
+			// an error written by one frame is read at the start of the next
+			std::atomic<bool> isQualityRequested{false};
+			QualityPhase qualityPhase = QualityPhase::Idle, measuredQualityPhase = QualityPhase::Idle;
+			bool isQualityFrame = false, isImageErrorPending = false;
+			std::chrono::high_resolution_clock::time_point qualityPhaseStart{};
+			uint32_t measuredQualityFrameCount = 0u, rawQualityFrameCount = 0u;
+			ImageError rawImageError{};
+
+			// Set when the accumulation restarts for a camera move, so the next frame reprojects the history.
+			// renderedCameraRay is the camera the uniform buffer last held
+			bool isReprojectPending = false, isReprojectFrame = false;
+			CameraRay renderedCameraRay{};
+
+			// Set by the render thread once the image has converged, cleared by the main thread on any change worth rendering.
+			// The waits go through the mutex, the polls in either loop only need the atomic
+			std::atomic<bool> isConverged{false};
+			std::mutex convergenceMutex;
+			std::condition_variable convergenceCondition;
+			bool hasAreaLight = false, hasSunLight = false;
+
+			// Workgroup size and stack depth come from the device, the rest from the scene and the constants above
+			KernelConfig kernelConfig{};
+			std::atomic<float> frameTime{0.0f};
+
+			// Written by the main thread on the toggle key, taken over by the render thread between frames
+			std::atomic<RenderMode> renderMode{DEFAULT_RENDER_MODE};
+			std::atomic<bool> isRenderModeChanged{false};
+
+			// Frame time totals per render mode, printed as the comparison between them
+			double totalFrameTimes[static_cast<uint32_t>(RenderMode::Count)] {};
+			uint32_t totalFrameCounts[static_cast<uint32_t>(RenderMode::Count)] {};
+			double totalDenoisedFrameTime = 0.0;
+			uint32_t totalDenoisedFrameCount = 0u;
 
 			RayTraceUbo globalUbo;
+			SunLight sunLight{};
 	};
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "convergence_storage_buffer.hpp"
+
+namespace nugiEngine {
+	EngineConvergenceStorageBuffer::EngineConvergenceStorageBuffer(EngineDevice &device, uint32_t pixelCount) : engineDevice{device} {
+		this->createBuffers(pixelCount);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineConvergenceStorageBuffer::getBuffersInfo() {
+		std::vector<VkDescriptorBufferInfo> buffersInfo{};
+		
+		for (uint32_t i = 0; i < this->buffers.size(); i++) {
+			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
+		}
+
+		return buffersInfo;
+	}
+
+	uint32_t EngineConvergenceStorageBuffer::getActivePixelCount(uint32_t frameIndex) {
+		return *static_cast<uint32_t*>(this->buffers.at(static_cast<size_t>(frameIndex))->getMappedMemory());
+	}
+
+	// Until a mask pass has counted them, every pixel is taken as active
+	void EngineConvergenceStorageBuffer::createBuffers(uint32_t pixelCount) {
+		this->buffers.clear();
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			auto buffer = std::make_shared<EngineBuffer>(
+				this->engineDevice,
+				static_cast<VkDeviceSize>(sizeof(uint32_t)),
+				1u,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			);
+
+			buffer->map();
+			buffer->writeToBuffer(&pixelCount);
+
+			this->buffers.emplace_back(buffer);
+		}
+	}
+
+	void EngineConvergenceStorageBuffer::reset(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		vkCmdFillBuffer(commandBuffer->getCommandBuffer(), this->buffers.at(static_cast<size_t>(frameIndex))->getBuffer(), 0, sizeof(uint32_t), 0u);
+	}
+
+	void EngineConvergenceStorageBuffer::transferToHost(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 
+			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
+	}
+} // namespace nugiEngine
\ No newline at end of file
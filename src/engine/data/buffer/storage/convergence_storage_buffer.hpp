@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/command/command_buffer.hpp"
+#include "../../../ray_ubo.hpp"
+
+#include <vector>
+#include <memory>
+
+namespace nugiEngine {
+	// Active pixel count of the last adaptive mask pass. Kept in host visible memory so the render loop can read it
+	// once the frame that wrote it has finished, without a copy back
+	class EngineConvergenceStorageBuffer {
+		public:
+			EngineConvergenceStorageBuffer(EngineDevice &device, uint32_t pixelCount);
+
+			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
+			uint32_t getActivePixelCount(uint32_t frameIndex);
+
+			void reset(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+			void transferToHost(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+			
+		private:
+			EngineDevice &engineDevice;
+			std::vector<std::shared_ptr<EngineBuffer>> buffers;
+
+			void createBuffers(uint32_t pixelCount);
+	};
+} // namespace nugiEngine
\ No newline at end of file
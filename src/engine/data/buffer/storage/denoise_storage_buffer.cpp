@@ -0,0 +1,64 @@
+#include "denoise_storage_buffer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+namespace nugiEngine {
+	EngineDenoiseStorageBuffer::EngineDenoiseStorageBuffer(EngineDevice &device, uint32_t pixelCount) : engineDevice{device} {
+		auto datas = std::make_shared<std::vector<glm::vec4>>(pixelCount, glm::vec4{0.0f});
+
+		this->createBuffers(datas);
+	}
+
+	EngineDenoiseStorageBuffer::EngineDenoiseStorageBuffer(EngineDevice &device, uint32_t pixelCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(glm::vec4)), pixelCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineDenoiseStorageBuffer::getBuffersInfo() {
+		std::vector<VkDescriptorBufferInfo> buffersInfo{};
+		
+		for (int i = 0; i < this->buffers.size(); i++) {
+			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
+		}
+
+		return buffersInfo;
+	}
+
+	void EngineDenoiseStorageBuffer::createBuffers(std::shared_ptr<std::vector<glm::vec4>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(glm::vec4));
+		auto instanceCount = static_cast<uint32_t>(datas->size());
+		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
+		
+		this->buffers.clear();
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			EngineBuffer stagingBuffer {
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			};
+
+			stagingBuffer.map();
+			stagingBuffer.writeToBuffer(datas->data());
+
+			auto buffer = std::make_shared<EngineBuffer>(
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+			);
+
+			buffer->copyBuffer(stagingBuffer.getBuffer(), totalSize);
+			this->buffers.emplace_back(buffer);
+		}
+	}
+} // namespace nugiEngine
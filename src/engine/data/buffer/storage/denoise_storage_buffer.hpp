@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
+#include "../../../../vulkan/command/command_buffer.hpp"
+#include "../../../ray_ubo.hpp"
+#include "../../../utils/transform/transform.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <memory>
+
+namespace nugiEngine {
+	// Demodulated color and its variance per pixel, one of the two buffers the a-trous iterations ping-pong between.
+	// The quality run keeps its reference radiance in one as well
+	class EngineDenoiseStorageBuffer {
+		public:
+			EngineDenoiseStorageBuffer(EngineDevice &device, uint32_t pixelCount);
+			EngineDenoiseStorageBuffer(EngineDevice &device, uint32_t pixelCount, EngineTransientAllocator &allocator);
+
+			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
+			
+		private:
+			EngineDevice &engineDevice;
+			std::vector<std::shared_ptr<EngineBuffer>> buffers;
+
+			void createBuffers(std::shared_ptr<std::vector<glm::vec4>> datas);
+	};
+} // namespace nugiEngine
@@ -18,6 +18,12 @@ namespace nugiEngine {
 		this->createBuffers(datas);
 	}
 
+	EngineDirectDataStorageBuffer::EngineDirectDataStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(DirectData)), dataCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+	}
+
 	std::vector<VkDescriptorBufferInfo> EngineDirectDataStorageBuffer::getBuffersInfo() {
 		std::vector<VkDescriptorBufferInfo> buffersInfo{};
 		
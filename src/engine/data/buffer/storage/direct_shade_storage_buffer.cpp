@@ -18,6 +18,12 @@ namespace nugiEngine {
 		this->createBuffers(datas);
 	}
 
+	EngineDirectShadeStorageBuffer::EngineDirectShadeStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(DirectShadeRecord)), dataCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+	}
+
 	std::vector<VkDescriptorBufferInfo> EngineDirectShadeStorageBuffer::getBuffersInfo() {
 		std::vector<VkDescriptorBufferInfo> buffersInfo{};
 		
@@ -2,6 +2,7 @@
 
 #include "../../../../vulkan/device/device.hpp"
 #include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
 #include "../../../../vulkan/command/command_buffer.hpp"
 #include "../../../ray_ubo.hpp"
 #include "../../../utils/transform/transform.hpp"
@@ -17,6 +18,7 @@ namespace nugiEngine {
 	class EngineDirectShadeStorageBuffer {
 		public:
 			EngineDirectShadeStorageBuffer(EngineDevice &device, uint32_t dataCount);
+			EngineDirectShadeStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator);
 
 			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
 
@@ -9,15 +9,17 @@
 
 namespace nugiEngine {
 	EngineHitRecordStorageBuffer::EngineHitRecordStorageBuffer(EngineDevice &device, uint32_t dataCount) : engineDevice{device} {
-		auto datas = std::make_shared<std::vector<HitRecord>>();
-		for (uint32_t i = 0; i < dataCount; i++) {
-			HitRecord data{};
-			datas->emplace_back(data);
-		}
+		auto datas = std::make_shared<std::vector<glm::uvec4>>(dataCount * EngineHitRecordStorageBuffer::PLANE_COUNT, glm::uvec4{0u});
 
 		this->createBuffers(datas);
 	}
 
+	EngineHitRecordStorageBuffer::EngineHitRecordStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(glm::uvec4)), dataCount * EngineHitRecordStorageBuffer::PLANE_COUNT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+	}
+
 	std::vector<VkDescriptorBufferInfo> EngineHitRecordStorageBuffer::getBuffersInfo() {
 		std::vector<VkDescriptorBufferInfo> buffersInfo{};
 		
@@ -28,8 +30,8 @@ namespace nugiEngine {
 		return buffersInfo;
 	}
 
-	void EngineHitRecordStorageBuffer::createBuffers(std::shared_ptr<std::vector<HitRecord>> datas) {
-		auto bufferSize = static_cast<VkDeviceSize>(sizeof(HitRecord));
+	void EngineHitRecordStorageBuffer::createBuffers(std::shared_ptr<std::vector<glm::uvec4>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(glm::uvec4));
 		auto instanceCount = static_cast<uint32_t>(datas->size());
 		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
 
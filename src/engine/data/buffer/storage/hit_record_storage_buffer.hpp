@@ -2,6 +2,7 @@
 
 #include "../../../../vulkan/device/device.hpp"
 #include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
 #include "../../../../vulkan/command/command_buffer.hpp"
 #include "../../../ray_ubo.hpp"
 #include "../../../utils/transform/transform.hpp"
@@ -14,9 +15,14 @@
 #include <memory>
 
 namespace nugiEngine {
+	// Stored as structure of arrays, each plane holds one 16 byte vector per path slot
 	class EngineHitRecordStorageBuffer {
 		public:
+			// Flags and indices, then point and distance, then uv, as in core/path_state.glsl
+			static constexpr uint32_t PLANE_COUNT = 3u;
+
 			EngineHitRecordStorageBuffer(EngineDevice &device, uint32_t dataCount);
+			EngineHitRecordStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator);
 
 			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
 
@@ -27,6 +33,6 @@ namespace nugiEngine {
 			EngineDevice &engineDevice;
 			std::vector<std::shared_ptr<EngineBuffer>> buffers;
 
-			void createBuffers(std::shared_ptr<std::vector<HitRecord>> datas);
+			void createBuffers(std::shared_ptr<std::vector<glm::uvec4>> datas);
 	};
 } // namespace nugiEngine
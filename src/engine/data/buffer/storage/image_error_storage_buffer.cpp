@@ -0,0 +1,55 @@
+#include "image_error_storage_buffer.hpp"
+
+#include <cmath>
+
+namespace nugiEngine {
+	EngineImageErrorStorageBuffer::EngineImageErrorStorageBuffer(EngineDevice &device, uint32_t pixelCount) : engineDevice{device}, pixelCount{pixelCount} {
+		this->createBuffers();
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineImageErrorStorageBuffer::getBuffersInfo() {
+		std::vector<VkDescriptorBufferInfo> buffersInfo{};
+		
+		for (uint32_t i = 0; i < this->buffers.size(); i++) {
+			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
+		}
+
+		return buffersInfo;
+	}
+
+	// Summed in double, a float sum over a million pixels would lose the small errors of a nearly converged image
+	ImageError EngineImageErrorStorageBuffer::getImageError(uint32_t frameIndex) {
+		auto errors = static_cast<glm::vec2*>(this->buffers.at(static_cast<size_t>(frameIndex))->getMappedMemory());
+		double squaredError = 0.0, relativeSquaredError = 0.0;
+
+		for (uint32_t i = 0; i < this->pixelCount; i++) {
+			squaredError += static_cast<double>(errors[i].x);
+			relativeSquaredError += static_cast<double>(errors[i].y);
+		}
+
+		double channelCount = 3.0 * static_cast<double>(this->pixelCount);
+		return ImageError{ std::sqrt(squaredError / channelCount), relativeSquaredError / channelCount };
+	}
+
+	void EngineImageErrorStorageBuffer::createBuffers() {
+		this->buffers.clear();
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			auto buffer = std::make_shared<EngineBuffer>(
+				this->engineDevice,
+				static_cast<VkDeviceSize>(sizeof(glm::vec2)),
+				this->pixelCount,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			);
+
+			buffer->map();
+			this->buffers.emplace_back(buffer);
+		}
+	}
+
+	void EngineImageErrorStorageBuffer::transferToHost(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 
+			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
+	}
+} // namespace nugiEngine
\ No newline at end of file
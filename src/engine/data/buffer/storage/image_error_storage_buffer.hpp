@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/command/command_buffer.hpp"
+#include "../../../ray_ubo.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <memory>
+
+namespace nugiEngine {
+	// Over every pixel and color channel, relMse divides each squared error by the squared reference first
+	struct ImageError {
+		double rmse = 0.0;
+		double relMse = 0.0;
+	};
+
+	// Squared and relative squared error of every pixel against the quality reference. Host visible like the convergence
+	// count, the render loop sums it once the frame that wrote it has finished
+	class EngineImageErrorStorageBuffer {
+		public:
+			EngineImageErrorStorageBuffer(EngineDevice &device, uint32_t pixelCount);
+
+			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
+			ImageError getImageError(uint32_t frameIndex);
+
+			void transferToHost(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+			
+		private:
+			EngineDevice &engineDevice;
+			std::vector<std::shared_ptr<EngineBuffer>> buffers;
+			uint32_t pixelCount;
+
+			void createBuffers();
+	};
+} // namespace nugiEngine
\ No newline at end of file
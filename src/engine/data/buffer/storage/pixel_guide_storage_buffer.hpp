@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
+#include "../../../../vulkan/command/command_buffer.hpp"
+#include "../../../ray_ubo.hpp"
+#include "../../../utils/transform/transform.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <memory>
+
+namespace nugiEngine {
+	class EnginePixelGuideStorageBuffer {
+		public:
+			EnginePixelGuideStorageBuffer(EngineDevice &device, uint32_t dataCount);
+			EnginePixelGuideStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator);
+
+			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
+			void copyFrom(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex, std::vector<VkDescriptorBufferInfo> sourceBuffersInfo);
+			
+		private:
+			EngineDevice &engineDevice;
+			std::vector<std::shared_ptr<EngineBuffer>> buffers;
+
+			void createBuffers(std::shared_ptr<std::vector<PixelGuide>> datas);
+	};
+} // namespace nugiEngine
@@ -0,0 +1,85 @@
+#include "pixel_statistics_storage_buffer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+namespace nugiEngine {
+	EnginePixelStatisticsStorageBuffer::EnginePixelStatisticsStorageBuffer(EngineDevice &device, uint32_t dataCount) : engineDevice{device} {
+		auto datas = std::make_shared<std::vector<PixelStatistics>>();
+		for (uint32_t i = 0; i < dataCount; i++) {
+			// Every pixel starts active, the adaptive mask pass is what retires the converged ones
+			PixelStatistics data{};
+			data.isActive = 1u;
+			
+			datas->emplace_back(data);
+		}
+
+		this->createBuffers(datas);
+	}
+
+	// History of the last frame, only kept while the reprojection pass reads it
+	EnginePixelStatisticsStorageBuffer::EnginePixelStatisticsStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(PixelStatistics)), dataCount, 
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EnginePixelStatisticsStorageBuffer::getBuffersInfo() {
+		std::vector<VkDescriptorBufferInfo> buffersInfo{};
+		
+		for (int i = 0; i < this->buffers.size(); i++) {
+			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
+		}
+
+		return buffersInfo;
+	}
+
+	void EnginePixelStatisticsStorageBuffer::copyFrom(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex, std::vector<VkDescriptorBufferInfo> sourceBuffersInfo) {
+		VkDescriptorBufferInfo sourceBufferInfo = sourceBuffersInfo[frameIndex];
+
+		VkBufferCopy copyRegion{};
+		copyRegion.srcOffset = sourceBufferInfo.offset;
+		copyRegion.dstOffset = 0;
+		copyRegion.size = this->buffers.at(static_cast<size_t>(frameIndex))->getBufferSize();
+
+		vkCmdCopyBuffer(commandBuffer->getCommandBuffer(), sourceBufferInfo.buffer, this->buffers.at(static_cast<size_t>(frameIndex))->getBuffer(), 1, &copyRegion);
+	}
+
+	void EnginePixelStatisticsStorageBuffer::createBuffers(std::shared_ptr<std::vector<PixelStatistics>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(PixelStatistics));
+		auto instanceCount = static_cast<uint32_t>(datas->size());
+		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
+		
+		this->buffers.clear();
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			EngineBuffer stagingBuffer {
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			};
+
+			stagingBuffer.map();
+			stagingBuffer.writeToBuffer(datas->data());
+
+			auto buffer = std::make_shared<EngineBuffer>(
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+			);
+
+			buffer->copyBuffer(stagingBuffer.getBuffer(), totalSize);
+			this->buffers.emplace_back(buffer);
+		}
+	}
+} // namespace nugiEngine
+
@@ -9,15 +9,17 @@
 
 namespace nugiEngine {
 	EngineRayDataStorageBuffer::EngineRayDataStorageBuffer(EngineDevice &device, uint32_t dataCount) : engineDevice{device} {
-		auto datas = std::make_shared<std::vector<RayData>>();
-		for (uint32_t i = 0; i < dataCount; i++) {
-			RayData data{};
-			datas->emplace_back(data);
-		}
+		auto datas = std::make_shared<std::vector<glm::uvec4>>(dataCount * EngineRayDataStorageBuffer::PLANE_COUNT, glm::uvec4{0u});
 
 		this->createBuffers(datas);
 	}
 
+	EngineRayDataStorageBuffer::EngineRayDataStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(glm::uvec4)), dataCount * EngineRayDataStorageBuffer::PLANE_COUNT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+	}
+
 	std::vector<VkDescriptorBufferInfo> EngineRayDataStorageBuffer::getBuffersInfo() {
 		std::vector<VkDescriptorBufferInfo> buffersInfo{};
 		
@@ -28,8 +30,8 @@ namespace nugiEngine {
 		return buffersInfo;
 	}
 
-	void EngineRayDataStorageBuffer::createBuffers(std::shared_ptr<std::vector<RayData>> datas) {
-		auto bufferSize = static_cast<VkDeviceSize>(sizeof(RayData));
+	void EngineRayDataStorageBuffer::createBuffers(std::shared_ptr<std::vector<glm::uvec4>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(glm::uvec4));
 		auto instanceCount = static_cast<uint32_t>(datas->size());
 		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
 		
@@ -1,4 +1,4 @@
-#include "light_shade_storage_buffer.hpp"
+#include "ray_order_storage_buffer.hpp"
 
 #include <cstring>
 #include <iostream>
@@ -8,28 +8,35 @@
 #include <glm/gtx/hash.hpp>
 
 namespace nugiEngine {
-	EngineLightShadeStorageBuffer::EngineLightShadeStorageBuffer(EngineDevice &device, uint32_t dataCount) : engineDevice{device} {
-		auto datas = std::make_shared<std::vector<LightShadeRecord>>();
-		for (uint32_t i = 0; i < dataCount; i++) {
-			LightShadeRecord data{};
-			datas->emplace_back(data);
+	EngineRayOrderStorageBuffer::EngineRayOrderStorageBuffer(EngineDevice &device, uint32_t rayCount) : engineDevice{device} {
+		// Starts as the identity order, so intersection is correct even before the first sort
+		auto datas = std::make_shared<std::vector<uint32_t>>(rayCount);
+		for (uint32_t i = 0; i < rayCount; i++) {
+			datas->at(static_cast<size_t>(i)) = i;
 		}
 
 		this->createBuffers(datas);
 	}
 
-	std::vector<VkDescriptorBufferInfo> EngineLightShadeStorageBuffer::getBuffersInfo() {
+	// Without the identity contents, only usable when the sort fills the order before every read
+	EngineRayOrderStorageBuffer::EngineRayOrderStorageBuffer(EngineDevice &device, uint32_t rayCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(uint32_t)), rayCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineRayOrderStorageBuffer::getBuffersInfo() {
 		std::vector<VkDescriptorBufferInfo> buffersInfo{};
 		
-		for (int i = 0; i < this->buffers.size(); i++) {
+		for (uint32_t i = 0; i < this->buffers.size(); i++) {
 			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
 		}
 
 		return buffersInfo;
 	}
 
-	void EngineLightShadeStorageBuffer::createBuffers(std::shared_ptr<std::vector<LightShadeRecord>> datas) {
-		auto bufferSize = static_cast<VkDeviceSize>(sizeof(LightShadeRecord));
+	void EngineRayOrderStorageBuffer::createBuffers(std::shared_ptr<std::vector<uint32_t>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(uint32_t));
 		auto instanceCount = static_cast<uint32_t>(datas->size());
 		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
 
@@ -60,14 +67,13 @@ namespace nugiEngine {
 		}
 	}
 
-	void EngineLightShadeStorageBuffer::transferToRead(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+	void EngineRayOrderStorageBuffer::transferToRead(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
 		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
 			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
 	}
 
-	void EngineLightShadeStorageBuffer::transferToWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+	void EngineRayOrderStorageBuffer::transferToWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
 		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
 			VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
-	} 
+	}
 } // namespace nugiEngine
-
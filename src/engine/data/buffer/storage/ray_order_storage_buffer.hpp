@@ -2,6 +2,7 @@
 
 #include "../../../../vulkan/device/device.hpp"
 #include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
 #include "../../../../vulkan/command/command_buffer.hpp"
 #include "../../../ray_ubo.hpp"
 #include "../../../utils/transform/transform.hpp"
@@ -14,9 +15,10 @@
 #include <memory>
 
 namespace nugiEngine {
-	class EngineMissRecordStorageBuffer {
+	class EngineRayOrderStorageBuffer {
 		public:
-			EngineMissRecordStorageBuffer(EngineDevice &device, uint32_t dataCount);
+			EngineRayOrderStorageBuffer(EngineDevice &device, uint32_t rayCount);
+			EngineRayOrderStorageBuffer(EngineDevice &device, uint32_t rayCount, EngineTransientAllocator &allocator);
 
 			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
 
@@ -27,6 +29,6 @@ namespace nugiEngine {
 			EngineDevice &engineDevice;
 			std::vector<std::shared_ptr<EngineBuffer>> buffers;
 
-			void createBuffers(std::shared_ptr<std::vector<MissRecord>> datas);
+			void createBuffers(std::shared_ptr<std::vector<uint32_t>> datas);
 	};
 } // namespace nugiEngine
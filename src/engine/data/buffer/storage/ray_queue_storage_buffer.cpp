@@ -0,0 +1,80 @@
+#include "ray_queue_storage_buffer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+namespace nugiEngine {
+	EngineRayQueueStorageBuffer::EngineRayQueueStorageBuffer(EngineDevice &device, uint32_t rayCount) : engineDevice{device} {
+		// VkDispatchIndirectCommand followed by the live ray count and the live ray indices
+		auto datas = std::make_shared<std::vector<uint32_t>>(rayCount + 4u, 0u);
+		datas->at(1) = 1u;
+		datas->at(2) = 1u;
+
+		this->createBuffers(datas);
+	}
+
+	// The header is written by reset() before every use
+	EngineRayQueueStorageBuffer::EngineRayQueueStorageBuffer(EngineDevice &device, uint32_t rayCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(uint32_t)), rayCount + 4u, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineRayQueueStorageBuffer::getBuffersInfo() {
+		std::vector<VkDescriptorBufferInfo> buffersInfo{};
+		
+		for (uint32_t i = 0; i < this->buffers.size(); i++) {
+			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
+		}
+
+		return buffersInfo;
+	}
+
+	void EngineRayQueueStorageBuffer::createBuffers(std::shared_ptr<std::vector<uint32_t>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(uint32_t));
+		auto instanceCount = static_cast<uint32_t>(datas->size());
+		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
+
+		this->buffers.clear();
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			EngineBuffer stagingBuffer {
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			};
+
+			stagingBuffer.map();
+			stagingBuffer.writeToBuffer(datas->data());
+
+			auto buffer = std::make_shared<EngineBuffer>(
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+			);
+
+			buffer->copyBuffer(stagingBuffer.getBuffer(), totalSize);
+			this->buffers.emplace_back(buffer);
+		}
+	}
+
+	void EngineRayQueueStorageBuffer::reset(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		auto buffer = this->buffers.at(static_cast<size_t>(frameIndex));
+		uint32_t header[4] { 0u, 1u, 1u, 0u };
+
+		vkCmdUpdateBuffer(commandBuffer->getCommandBuffer(), buffer->getBuffer(), 0, sizeof(header), header);
+	}
+
+	void EngineRayQueueStorageBuffer::transferToIndirect(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
+			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
+	} 
+} // namespace nugiEngine
@@ -0,0 +1,77 @@
+#include "ray_sort_storage_buffer.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+namespace nugiEngine {
+	EngineRaySortStorageBuffer::EngineRaySortStorageBuffer(EngineDevice &device, uint32_t rayCount) : engineDevice{device} {
+		// Bucket counts and bucket starts, followed by one (key, rank in bucket) pair per ray
+		auto datas = std::make_shared<std::vector<uint32_t>>(2u * EngineRaySortStorageBuffer::BUCKET_COUNT + 2u * rayCount, 0u);
+
+		this->createBuffers(datas);
+	}
+
+	EngineRaySortStorageBuffer::EngineRaySortStorageBuffer(EngineDevice &device, uint32_t rayCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(uint32_t)), 2u * EngineRaySortStorageBuffer::BUCKET_COUNT + 2u * rayCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineRaySortStorageBuffer::getBuffersInfo() {
+		std::vector<VkDescriptorBufferInfo> buffersInfo{};
+		
+		for (uint32_t i = 0; i < this->buffers.size(); i++) {
+			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
+		}
+
+		return buffersInfo;
+	}
+
+	void EngineRaySortStorageBuffer::createBuffers(std::shared_ptr<std::vector<uint32_t>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(uint32_t));
+		auto instanceCount = static_cast<uint32_t>(datas->size());
+		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
+
+		this->buffers.clear();
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			EngineBuffer stagingBuffer {
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			};
+
+			stagingBuffer.map();
+			stagingBuffer.writeToBuffer(datas->data());
+
+			auto buffer = std::make_shared<EngineBuffer>(
+				this->engineDevice,
+				bufferSize,
+				instanceCount,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+			);
+
+			buffer->copyBuffer(stagingBuffer.getBuffer(), totalSize);
+			this->buffers.emplace_back(buffer);
+		}
+	}
+
+	void EngineRaySortStorageBuffer::transferToReadWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
+			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
+	}
+
+	// Ranks are handed out by atomics on the bucket counts, so only the counts need to start at zero
+	void EngineRaySortStorageBuffer::reset(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		auto buffer = this->buffers.at(static_cast<size_t>(frameIndex));
+
+		vkCmdFillBuffer(commandBuffer->getCommandBuffer(), buffer->getBuffer(), 0, static_cast<VkDeviceSize>(sizeof(uint32_t) * EngineRaySortStorageBuffer::BUCKET_COUNT), 0u);
+	} 
+} // namespace nugiEngine
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
+#include "../../../../vulkan/command/command_buffer.hpp"
+#include "../../../ray_ubo.hpp"
+#include "../../../utils/transform/transform.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <memory>
+
+namespace nugiEngine {
+	class EngineRaySortStorageBuffer {
+		public:
+			EngineRaySortStorageBuffer(EngineDevice &device, uint32_t rayCount);
+			EngineRaySortStorageBuffer(EngineDevice &device, uint32_t rayCount, EngineTransientAllocator &allocator);
+
+			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
+
+			void transferToReadWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+			void reset(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+
+			static constexpr uint32_t BUCKET_COUNT = 512u;
+			
+		private:
+			EngineDevice &engineDevice;
+			std::vector<std::shared_ptr<EngineBuffer>> buffers;
+
+			void createBuffers(std::shared_ptr<std::vector<uint32_t>> datas);
+	};
+} // namespace nugiEngine
@@ -1,4 +1,4 @@
-#include "miss_record_storage_buffer.hpp"
+#include "shade_storage_buffer.hpp"
 
 #include <cstring>
 #include <iostream>
@@ -8,17 +8,23 @@
 #include <glm/gtx/hash.hpp>
 
 namespace nugiEngine {
-	EngineMissRecordStorageBuffer::EngineMissRecordStorageBuffer(EngineDevice &device, uint32_t dataCount) : engineDevice{device} {
-		auto datas = std::make_shared<std::vector<MissRecord>>();
+	EngineShadeStorageBuffer::EngineShadeStorageBuffer(EngineDevice &device, uint32_t dataCount) : engineDevice{device} {
+		auto datas = std::make_shared<std::vector<ShadeRecord>>();
 		for (uint32_t i = 0; i < dataCount; i++) {
-			MissRecord data{};
+			ShadeRecord data{};
 			datas->emplace_back(data);
 		}
 
 		this->createBuffers(datas);
 	}
 
-	std::vector<VkDescriptorBufferInfo> EngineMissRecordStorageBuffer::getBuffersInfo() {
+	EngineShadeStorageBuffer::EngineShadeStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(ShadeRecord)), dataCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineShadeStorageBuffer::getBuffersInfo() {
 		std::vector<VkDescriptorBufferInfo> buffersInfo{};
 		
 		for (int i = 0; i < this->buffers.size(); i++) {
@@ -28,8 +34,8 @@ namespace nugiEngine {
 		return buffersInfo;
 	}
 
-	void EngineMissRecordStorageBuffer::createBuffers(std::shared_ptr<std::vector<MissRecord>> datas) {
-		auto bufferSize = static_cast<VkDeviceSize>(sizeof(MissRecord));
+	void EngineShadeStorageBuffer::createBuffers(std::shared_ptr<std::vector<ShadeRecord>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(ShadeRecord));
 		auto instanceCount = static_cast<uint32_t>(datas->size());
 		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
 
@@ -60,12 +66,12 @@ namespace nugiEngine {
 		}
 	}
 
-	void EngineMissRecordStorageBuffer::transferToRead(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+	void EngineShadeStorageBuffer::transferToRead(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
 		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
 			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
 	}
 
-	void EngineMissRecordStorageBuffer::transferToWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+	void EngineShadeStorageBuffer::transferToWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
 		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
 			VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
 	} 
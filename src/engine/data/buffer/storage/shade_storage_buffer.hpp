@@ -2,6 +2,7 @@
 
 #include "../../../../vulkan/device/device.hpp"
 #include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
 #include "../../../../vulkan/command/command_buffer.hpp"
 #include "../../../ray_ubo.hpp"
 #include "../../../utils/transform/transform.hpp"
@@ -14,9 +15,10 @@
 #include <memory>
 
 namespace nugiEngine {
-	class EngineLightShadeStorageBuffer {
+	class EngineShadeStorageBuffer {
 		public:
-			EngineLightShadeStorageBuffer(EngineDevice &device, uint32_t dataCount);
+			EngineShadeStorageBuffer(EngineDevice &device, uint32_t dataCount);
+			EngineShadeStorageBuffer(EngineDevice &device, uint32_t dataCount, EngineTransientAllocator &allocator);
 
 			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
 
@@ -27,6 +29,6 @@ namespace nugiEngine {
 			EngineDevice &engineDevice;
 			std::vector<std::shared_ptr<EngineBuffer>> buffers;
 
-			void createBuffers(std::shared_ptr<std::vector<LightShadeRecord>> datas);
+			void createBuffers(std::shared_ptr<std::vector<ShadeRecord>> datas);
 	};
 } // namespace nugiEngine
@@ -1,4 +1,4 @@
-#include "indirect_shade_storage_buffer.hpp"
+#include "visibility_storage_buffer.hpp"
 
 #include <cstring>
 #include <iostream>
@@ -8,28 +8,32 @@
 #include <glm/gtx/hash.hpp>
 
 namespace nugiEngine {
-	EngineIndirectShadeStorageBuffer::EngineIndirectShadeStorageBuffer(EngineDevice &device, uint32_t dataCount) : engineDevice{device} {
-		auto datas = std::make_shared<std::vector<IndirectShadeRecord>>();
-		for (uint32_t i = 0; i < dataCount; i++) {
-			IndirectShadeRecord data{};
-			datas->emplace_back(data);
-		}
+	EngineVisibilityStorageBuffer::EngineVisibilityStorageBuffer(EngineDevice &device, uint32_t rayCount) : engineDevice{device} {
+		// One visibility bit per ray, packed 32 rays to a word
+		auto datas = std::make_shared<std::vector<uint32_t>>((rayCount + 31u) / 32u, 0u);
 
 		this->createBuffers(datas);
 	}
 
-	std::vector<VkDescriptorBufferInfo> EngineIndirectShadeStorageBuffer::getBuffersInfo() {
+	// No initial data, clear() runs before every use
+	EngineVisibilityStorageBuffer::EngineVisibilityStorageBuffer(EngineDevice &device, uint32_t rayCount, EngineTransientAllocator &allocator) 
+		: engineDevice{device} 
+	{
+		this->buffers = allocator.createBuffers(static_cast<VkDeviceSize>(sizeof(uint32_t)), (rayCount + 31u) / 32u, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineVisibilityStorageBuffer::getBuffersInfo() {
 		std::vector<VkDescriptorBufferInfo> buffersInfo{};
 		
-		for (int i = 0; i < this->buffers.size(); i++) {
+		for (uint32_t i = 0; i < this->buffers.size(); i++) {
 			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
 		}
 
 		return buffersInfo;
 	}
 
-	void EngineIndirectShadeStorageBuffer::createBuffers(std::shared_ptr<std::vector<IndirectShadeRecord>> datas) {
-		auto bufferSize = static_cast<VkDeviceSize>(sizeof(IndirectShadeRecord));
+	void EngineVisibilityStorageBuffer::createBuffers(std::shared_ptr<std::vector<uint32_t>> datas) {
+		auto bufferSize = static_cast<VkDeviceSize>(sizeof(uint32_t));
 		auto instanceCount = static_cast<uint32_t>(datas->size());
 		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
 
@@ -60,14 +64,16 @@ namespace nugiEngine {
 		}
 	}
 
-	void EngineIndirectShadeStorageBuffer::transferToRead(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+	void EngineVisibilityStorageBuffer::transferToRead(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
 		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
 			VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
 	}
 
-	void EngineIndirectShadeStorageBuffer::transferToWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
-		this->buffers.at(static_cast<size_t>(frameIndex))->transitionBuffer(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 
-			VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, commandBuffer);
+	// Shadow rays only set the bits of visible rays, so every bit has to start cleared
+	void EngineVisibilityStorageBuffer::clear(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		auto buffer = this->buffers.at(static_cast<size_t>(frameIndex));
+
+		vkCmdFillBuffer(commandBuffer->getCommandBuffer(), buffer->getBuffer(), 0, VK_WHOLE_SIZE, 0u);
 	} 
 } // namespace nugiEngine
 
@@ -2,6 +2,7 @@
 
 #include "../../../../vulkan/device/device.hpp"
 #include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/buffer/transient_allocator.hpp"
 #include "../../../../vulkan/command/command_buffer.hpp"
 #include "../../../ray_ubo.hpp"
 #include "../../../utils/transform/transform.hpp"
@@ -14,19 +15,20 @@
 #include <memory>
 
 namespace nugiEngine {
-	class EngineIndirectShadeStorageBuffer {
+	class EngineVisibilityStorageBuffer {
 		public:
-			EngineIndirectShadeStorageBuffer(EngineDevice &device, uint32_t dataCount);
+			EngineVisibilityStorageBuffer(EngineDevice &device, uint32_t rayCount);
+			EngineVisibilityStorageBuffer(EngineDevice &device, uint32_t rayCount, EngineTransientAllocator &allocator);
 
 			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
 
 			void transferToRead(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
-			void transferToWrite(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+			void clear(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
 			
 		private:
 			EngineDevice &engineDevice;
 			std::vector<std::shared_ptr<EngineBuffer>> buffers;
 
-			void createBuffers(std::shared_ptr<std::vector<IndirectShadeRecord>> datas);
+			void createBuffers(std::shared_ptr<std::vector<uint32_t>> datas);
 	};
 } // namespace nugiEngine
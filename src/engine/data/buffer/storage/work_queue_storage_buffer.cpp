@@ -0,0 +1,40 @@
+#include "work_queue_storage_buffer.hpp"
+
+namespace nugiEngine {
+	EngineWorkQueueStorageBuffer::EngineWorkQueueStorageBuffer(EngineDevice &device) : engineDevice{device} {
+		this->createBuffers();
+	}
+
+	std::vector<VkDescriptorBufferInfo> EngineWorkQueueStorageBuffer::getBuffersInfo() {
+		std::vector<VkDescriptorBufferInfo> buffersInfo{};
+		
+		for (uint32_t i = 0; i < this->buffers.size(); i++) {
+			buffersInfo.emplace_back(this->buffers.at(static_cast<size_t>(i))->descriptorInfo());
+		}
+
+		return buffersInfo;
+	}
+
+	// Only the index of the next pixel to take, reset() zeroes it before every frame
+	void EngineWorkQueueStorageBuffer::createBuffers() {
+		this->buffers.clear();
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			auto buffer = std::make_shared<EngineBuffer>(
+				this->engineDevice,
+				static_cast<VkDeviceSize>(sizeof(uint32_t)),
+				1u,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+			);
+
+			this->buffers.emplace_back(buffer);
+		}
+	}
+
+	void EngineWorkQueueStorageBuffer::reset(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		auto buffer = this->buffers.at(static_cast<size_t>(frameIndex));
+
+		vkCmdFillBuffer(commandBuffer->getCommandBuffer(), buffer->getBuffer(), 0, VK_WHOLE_SIZE, 0u);
+	} 
+} // namespace nugiEngine
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/command/command_buffer.hpp"
+
+#include <vector>
+#include <memory>
+
+namespace nugiEngine {
+	class EngineWorkQueueStorageBuffer {
+		public:
+			EngineWorkQueueStorageBuffer(EngineDevice &device);
+
+			std::vector<VkDescriptorBufferInfo> getBuffersInfo();
+			void reset(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+			
+		private:
+			EngineDevice &engineDevice;
+			std::vector<std::shared_ptr<EngineBuffer>> buffers;
+
+			void createBuffers();
+	};
+} // namespace nugiEngine
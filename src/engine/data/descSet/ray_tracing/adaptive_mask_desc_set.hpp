@@ -1,15 +1,16 @@
 #pragma once
 
-#include "../../../vulkan/device/device.hpp"
-#include "../../../vulkan/buffer/buffer.hpp"
-#include "../../../vulkan/descriptor/descriptor.hpp"
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/descriptor/descriptor.hpp"
 
 #include <memory>
 
 namespace nugiEngine {
-	class EngineSamplingDescSet {
+	class EngineAdaptiveMaskDescSet {
 		public:
-			EngineSamplingDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, std::vector<VkDescriptorImageInfo> samplingResourcesInfo[2]);
+			EngineAdaptiveMaskDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, 
+				std::vector<VkDescriptorBufferInfo> buffersInfo[2]);
 
 			VkDescriptorSet getDescriptorSets(int frameIndex) { return this->descriptorSets[frameIndex]; }
 			std::shared_ptr<EngineDescriptorSetLayout> getDescSetLayout() const { return this->descSetLayout; }
@@ -18,7 +19,8 @@ namespace nugiEngine {
       std::shared_ptr<EngineDescriptorSetLayout> descSetLayout;
 			std::vector<VkDescriptorSet> descriptorSets;
 
-			void createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, std::vector<VkDescriptorImageInfo> samplingResourcesInfo[2]);
+			void createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, 
+				std::vector<VkDescriptorBufferInfo> buffersInfo[2]);
 	};
 	
 }
\ No newline at end of file
@@ -2,23 +2,24 @@
 
 namespace nugiEngine {
   EngineDirectShadeDescSet::EngineDirectShadeDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> buffersInfo[4], VkDescriptorBufferInfo modelsInfo[3]) 
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[4], VkDescriptorBufferInfo modelsInfo[3]) 
 	{
-		this->createDescriptor(device, descriptorPool, buffersInfo, modelsInfo);
+		this->createDescriptor(device, descriptorPool, uniformBufferInfo, buffersInfo, modelsInfo);
   }
 
   void EngineDirectShadeDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> buffersInfo[4], VkDescriptorBufferInfo modelsInfo[3]) 
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[4], VkDescriptorBufferInfo modelsInfo[3]) 
 	{
     this->descSetLayout = 
 			EngineDescriptorSetLayout::Builder(device)
-				.addBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.addBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(5, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(6, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.addBinding(7, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.build();
 		
 	this->descriptorSets.clear();
@@ -26,13 +27,14 @@ namespace nugiEngine {
 			VkDescriptorSet descSet;
 
 			EngineDescriptorWriter(*this->descSetLayout, *descriptorPool)
-				.writeBuffer(0, &buffersInfo[0][i])
-				.writeBuffer(1, &buffersInfo[1][i])
-				.writeBuffer(2, &buffersInfo[2][i])
-				.writeBuffer(3, &buffersInfo[3][i])
-				.writeBuffer(4, &modelsInfo[0])
-				.writeBuffer(5, &modelsInfo[1])
-				.writeBuffer(6, &modelsInfo[2])
+				.writeBuffer(0, &uniformBufferInfo[i])
+				.writeBuffer(1, &buffersInfo[0][i])
+				.writeBuffer(2, &buffersInfo[1][i])
+				.writeBuffer(3, &buffersInfo[2][i])
+				.writeBuffer(4, &buffersInfo[3][i])
+				.writeBuffer(5, &modelsInfo[0])
+				.writeBuffer(6, &modelsInfo[1])
+				.writeBuffer(7, &modelsInfo[2])
 				.build(&descSet);
 
 			this->descriptorSets.emplace_back(descSet);
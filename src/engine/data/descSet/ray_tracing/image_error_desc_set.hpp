@@ -0,0 +1,27 @@
+#pragma once
+
+#include "../../../../vulkan/device/device.hpp"
+#include "../../../../vulkan/buffer/buffer.hpp"
+#include "../../../../vulkan/descriptor/descriptor.hpp"
+
+#include <memory>
+
+namespace nugiEngine {
+	// buffersInfo holds the pixel statistics, the denoised radiance, the reference and the per pixel errors
+	class EngineImageErrorDescSet {
+		public:
+			EngineImageErrorDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
+				std::vector<VkDescriptorBufferInfo> buffersInfo[4]);
+
+			VkDescriptorSet getDescriptorSets(int frameIndex) { return this->descriptorSets[frameIndex]; }
+			std::shared_ptr<EngineDescriptorSetLayout> getDescSetLayout() const { return this->descSetLayout; }
+
+		private:
+      std::shared_ptr<EngineDescriptorSetLayout> descSetLayout;
+			std::vector<VkDescriptorSet> descriptorSets;
+
+			void createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
+				std::vector<VkDescriptorBufferInfo> buffersInfo[4]);
+	};
+	
+}
\ No newline at end of file
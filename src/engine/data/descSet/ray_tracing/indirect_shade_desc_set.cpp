@@ -2,13 +2,13 @@
 
 namespace nugiEngine {
   EngineIndirectShadeDescSet::EngineIndirectShadeDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[1]) 
+		std::vector<VkDescriptorBufferInfo> buffersInfo[4], VkDescriptorBufferInfo modelsInfo[1]) 
 	{
 		this->createDescriptor(device, descriptorPool, buffersInfo, modelsInfo);
   }
 
   void EngineIndirectShadeDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[1]) 
+		std::vector<VkDescriptorBufferInfo> buffersInfo[4], VkDescriptorBufferInfo modelsInfo[1]) 
 	{
     this->descSetLayout = 
 			EngineDescriptorSetLayout::Builder(device)
@@ -16,6 +16,7 @@ namespace nugiEngine {
 				.addBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.addBinding(4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.build();
 		
 	this->descriptorSets.clear();
@@ -26,7 +27,8 @@ namespace nugiEngine {
 				.writeBuffer(0, &buffersInfo[0][i])
 				.writeBuffer(1, &buffersInfo[1][i])
 				.writeBuffer(2, &buffersInfo[2][i])
-				.writeBuffer(3, &modelsInfo[0])
+				.writeBuffer(3, &buffersInfo[3][i])
+				.writeBuffer(4, &modelsInfo[0])
 				.build(&descSet);
 
 			this->descriptorSets.emplace_back(descSet);
@@ -2,13 +2,13 @@
 
 namespace nugiEngine {
   EngineIntersectObjectDescSet::EngineIntersectObjectDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> buffersInfo[2], VkDescriptorBufferInfo modelsInfo[7]) 
+		std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[7]) 
 	{
 		this->createDescriptor(device, descriptorPool, buffersInfo, modelsInfo);
   }
 
   void EngineIntersectObjectDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-	std::vector<VkDescriptorBufferInfo> buffersInfo[2], VkDescriptorBufferInfo modelsInfo[7]) 
+	std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[7]) 
 	{
     this->descSetLayout = 
 			EngineDescriptorSetLayout::Builder(device)
@@ -21,6 +21,7 @@ namespace nugiEngine {
 				.addBinding(6, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(7, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(8, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.addBinding(9, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.build();
 		
 	this->descriptorSets.clear();
@@ -30,13 +31,14 @@ namespace nugiEngine {
 			auto y = EngineDescriptorWriter(*this->descSetLayout, *descriptorPool)
 				.writeBuffer(0, &buffersInfo[0][i])
 				.writeBuffer(1, &buffersInfo[1][i])
-				.writeBuffer(2, &modelsInfo[0])
-				.writeBuffer(3, &modelsInfo[1])
-				.writeBuffer(4, &modelsInfo[2])
-				.writeBuffer(5, &modelsInfo[3])
-				.writeBuffer(6, &modelsInfo[4])
-				.writeBuffer(7, &modelsInfo[5])
-				.writeBuffer(8, &modelsInfo[6])
+				.writeBuffer(2, &buffersInfo[2][i])
+				.writeBuffer(3, &modelsInfo[0])
+				.writeBuffer(4, &modelsInfo[1])
+				.writeBuffer(5, &modelsInfo[2])
+				.writeBuffer(6, &modelsInfo[3])
+				.writeBuffer(7, &modelsInfo[4])
+				.writeBuffer(8, &modelsInfo[5])
+				.writeBuffer(9, &modelsInfo[6])
 				.build(&descSet);
 
 			this->descriptorSets.emplace_back(descSet);
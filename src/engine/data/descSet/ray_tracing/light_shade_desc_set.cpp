@@ -2,21 +2,22 @@
 
 namespace nugiEngine {
   EngineLightShadeDescSet::EngineLightShadeDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[2]) 
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[2]) 
 	{
-		this->createDescriptor(device, descriptorPool, buffersInfo, modelsInfo);
+		this->createDescriptor(device, descriptorPool, uniformBufferInfo, buffersInfo, modelsInfo);
   }
 
   void EngineLightShadeDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, 
-		std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[2]) 
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[2]) 
 	{
     this->descSetLayout = 
 			EngineDescriptorSetLayout::Builder(device)
-				.addBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.addBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.addBinding(5, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.build();
 		
 	this->descriptorSets.clear();
@@ -24,11 +25,12 @@ namespace nugiEngine {
 			VkDescriptorSet descSet;
 
 			EngineDescriptorWriter(*this->descSetLayout, *descriptorPool)
-				.writeBuffer(0, &buffersInfo[0][i])
-				.writeBuffer(1, &buffersInfo[1][i])
-				.writeBuffer(2, &buffersInfo[2][i])
-				.writeBuffer(3, &modelsInfo[0])
-				.writeBuffer(4, &modelsInfo[1])
+				.writeBuffer(0, &uniformBufferInfo[i])
+				.writeBuffer(1, &buffersInfo[0][i])
+				.writeBuffer(2, &buffersInfo[1][i])
+				.writeBuffer(3, &buffersInfo[2][i])
+				.writeBuffer(4, &modelsInfo[0])
+				.writeBuffer(5, &modelsInfo[1])
 				.build(&descSet);
 
 			this->descriptorSets.emplace_back(descSet);
@@ -2,20 +2,19 @@
 
 namespace nugiEngine {
   EngineMissDescSet::EngineMissDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[3]) 
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[2]) 
 	{
 		this->createDescriptor(device, descriptorPool, uniformBufferInfo, buffersInfo);
   }
 
   void EngineMissDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, 
-		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[3]) 
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[2]) 
 	{
     this->descSetLayout = 
 			EngineDescriptorSetLayout::Builder(device)
 				.addBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-				.addBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.build();
 		
 	this->descriptorSets.clear();
@@ -26,7 +25,6 @@ namespace nugiEngine {
 				.writeBuffer(0, &uniformBufferInfo[i])
 				.writeBuffer(1, &buffersInfo[0][i])
 				.writeBuffer(2, &buffersInfo[1][i])
-				.writeBuffer(3, &buffersInfo[2][i])
 				.build(&descSet);
 
 			this->descriptorSets.emplace_back(descSet);
@@ -1,14 +1,14 @@
-#include "intersect_light_desc_set.hpp"
+#include "ray_sort_desc_set.hpp"
 
 namespace nugiEngine {
-  EngineIntersectLightDescSet::EngineIntersectLightDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> buffersInfo[2], VkDescriptorBufferInfo modelsInfo[3]) 
+  EngineRaySortDescSet::EngineRaySortDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
+		std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[1]) 
 	{
 		this->createDescriptor(device, descriptorPool, buffersInfo, modelsInfo);
   }
 
-  void EngineIntersectLightDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, 
-		std::vector<VkDescriptorBufferInfo> buffersInfo[2], VkDescriptorBufferInfo modelsInfo[3]) 
+  void EngineRaySortDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
+	std::vector<VkDescriptorBufferInfo> buffersInfo[3], VkDescriptorBufferInfo modelsInfo[1]) 
 	{
     this->descSetLayout = 
 			EngineDescriptorSetLayout::Builder(device)
@@ -16,7 +16,6 @@ namespace nugiEngine {
 				.addBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-				.addBinding(4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.build();
 		
 	this->descriptorSets.clear();
@@ -26,9 +25,8 @@ namespace nugiEngine {
 			EngineDescriptorWriter(*this->descSetLayout, *descriptorPool)
 				.writeBuffer(0, &buffersInfo[0][i])
 				.writeBuffer(1, &buffersInfo[1][i])
-				.writeBuffer(2, &modelsInfo[0])
-				.writeBuffer(3, &modelsInfo[1])
-				.writeBuffer(4, &modelsInfo[2])
+				.writeBuffer(2, &buffersInfo[2][i])
+				.writeBuffer(3, &modelsInfo[0])
 				.build(&descSet);
 
 			this->descriptorSets.emplace_back(descSet);
@@ -2,13 +2,13 @@
 
 namespace nugiEngine {
   EngineSunDirectSamplerDescSet::EngineSunDirectSamplerDescSet(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool,
-		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[5]) 
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[4]) 
 	{
 		this->createDescriptor(device, descriptorPool, uniformBufferInfo, buffersInfo);
   }
 
   void EngineSunDirectSamplerDescSet::createDescriptor(EngineDevice& device, std::shared_ptr<EngineDescriptorPool> descriptorPool, 
-		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[5])
+		std::vector<VkDescriptorBufferInfo> uniformBufferInfo, std::vector<VkDescriptorBufferInfo> buffersInfo[4])
 	{
     this->descSetLayout = 
 			EngineDescriptorSetLayout::Builder(device)
@@ -17,7 +17,6 @@ namespace nugiEngine {
 				.addBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.addBinding(4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-				.addBinding(5, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 				.build();
 		
 	this->descriptorSets.clear();
@@ -30,7 +29,6 @@ namespace nugiEngine {
 				.writeBuffer(2, &buffersInfo[1][i])
 				.writeBuffer(3, &buffersInfo[2][i])
 				.writeBuffer(4, &buffersInfo[3][i])
-				.writeBuffer(5, &buffersInfo[4][i])
 				.build(&descSet);
 
 			this->descriptorSets.emplace_back(descSet);
@@ -8,16 +8,11 @@
 #include <glm/gtx/hash.hpp>
 
 namespace nugiEngine {
-	EngineLightModel::EngineLightModel(EngineDevice &device, std::shared_ptr<std::vector<TriangleLight>> triangleLights, std::shared_ptr<std::vector<RayTraceVertex>> vertices) : engineDevice{device} {
-		std::vector<std::shared_ptr<BoundBox>> boundBoxes;
-		for (int i = 0; i < triangleLights->size(); i++) {
-			boundBoxes.push_back(std::make_shared<TriangleLightBoundBox>(TriangleLightBoundBox{ i + 1, triangleLights->at(i), vertices }));
-		}
-
-		this->createBuffers(triangleLights, createBvh(boundBoxes));
+	EngineLightModel::EngineLightModel(EngineDevice &device, std::shared_ptr<std::vector<TriangleLight>> triangleLights) : engineDevice{device} {
+		this->createBuffers(triangleLights);
 	}
 
-	void EngineLightModel::createBuffers(std::shared_ptr<std::vector<TriangleLight>> triangleLights, std::shared_ptr<std::vector<BvhNode>> bvhNodes) {
+	void EngineLightModel::createBuffers(std::shared_ptr<std::vector<TriangleLight>> triangleLights) {
 		auto bufferSize = static_cast<VkDeviceSize>(sizeof(TriangleLight));
 		auto instanceCount = static_cast<uint32_t>(triangleLights->size());
 		auto totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
@@ -42,33 +37,6 @@ namespace nugiEngine {
 		);
 
 		this->lightBuffer->copyBuffer(lightStagingBuffer.getBuffer(), totalSize);
-
-		// -------------------------------------------------
-
-		bufferSize = static_cast<VkDeviceSize>(sizeof(BvhNode));
-		instanceCount = static_cast<uint32_t>(bvhNodes->size());
-		totalSize = static_cast<VkDeviceSize>(bufferSize * instanceCount);
-
-		EngineBuffer bvhStagingBuffer {
-			this->engineDevice,
-			bufferSize,
-			instanceCount,
-			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-		};
-
-		bvhStagingBuffer.map();
-		bvhStagingBuffer.writeToBuffer(bvhNodes->data());
-
-		this->bvhBuffer = std::make_shared<EngineBuffer>(
-			this->engineDevice,
-			bufferSize,
-			instanceCount,
-			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-		);
-
-		this->bvhBuffer->copyBuffer(bvhStagingBuffer.getBuffer(), totalSize);
 	}
     
 } // namespace nugiEngine
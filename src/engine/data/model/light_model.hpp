@@ -3,7 +3,6 @@
 #include "../../../vulkan/device/device.hpp"
 #include "../../../vulkan/buffer/buffer.hpp"
 #include "../../../vulkan/command/command_buffer.hpp"
-#include "../../utils/bvh/bvh.hpp"
 #include "../../ray_ubo.hpp"
 
 #define GLM_FORCE_RADIANS
@@ -16,17 +15,15 @@
 namespace nugiEngine {
 	class EngineLightModel {
     public:
-      EngineLightModel(EngineDevice &device, std::shared_ptr<std::vector<TriangleLight>> triangleLights, std::shared_ptr<std::vector<RayTraceVertex>> vertices);
+      EngineLightModel(EngineDevice &device, std::shared_ptr<std::vector<TriangleLight>> triangleLights);
 
       VkDescriptorBufferInfo getLightInfo() { return this->lightBuffer->descriptorInfo(); }
-      VkDescriptorBufferInfo getBvhInfo() { return this->bvhBuffer->descriptorInfo(); }
       
     private:
       EngineDevice &engineDevice;
       
       std::shared_ptr<EngineBuffer> lightBuffer;
-      std::shared_ptr<EngineBuffer> bvhBuffer;
 
-      void createBuffers(std::shared_ptr<std::vector<TriangleLight>> triangleLights, std::shared_ptr<std::vector<BvhNode>> bvhNodes);
+      void createBuffers(std::shared_ptr<std::vector<TriangleLight>> triangleLights);
 	};
 } // namespace nugiEngine
@@ -6,7 +6,10 @@
 
 namespace nugiEngine {
 	EngineObjectModel::EngineObjectModel(EngineDevice &device, std::shared_ptr<std::vector<Object>> objects, std::vector<std::shared_ptr<BoundBox>> boundBoxes) : engineDevice{device} {
-		this->createBuffers(objects, createBvh(boundBoxes));
+		auto bvhNodes = createBvh(boundBoxes);
+		this->bvhHeight = nugiEngine::bvhHeight(*bvhNodes);
+
+		this->createBuffers(objects, bvhNodes);
 	}
 
 	void EngineObjectModel::createBuffers(std::shared_ptr<std::vector<Object>> objects, std::shared_ptr<std::vector<BvhNode>> bvhNodes) {
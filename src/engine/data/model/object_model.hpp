@@ -21,11 +21,14 @@ namespace nugiEngine {
       VkDescriptorBufferInfo getObjectInfo() { return this->objectBuffer->descriptorInfo();  }
       VkDescriptorBufferInfo getBvhInfo() { return this->bvhBuffer->descriptorInfo(); }
 
+      uint32_t getBvhHeight() const { return this->bvhHeight; }
+
     private:
       EngineDevice &engineDevice;
       
       std::shared_ptr<EngineBuffer> objectBuffer;
       std::shared_ptr<EngineBuffer> bvhBuffer;
+      uint32_t bvhHeight = 0u;
 
       void createBuffers(std::shared_ptr<std::vector<Object>> objects, std::shared_ptr<std::vector<BvhNode>> bvhNodes);
 	};
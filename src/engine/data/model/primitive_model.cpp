@@ -11,6 +11,7 @@ namespace nugiEngine {
 
 	void EnginePrimitiveModel::addPrimitive(std::shared_ptr<std::vector<Primitive>> curPrimitives, std::shared_ptr<std::vector<RayTraceVertex>> vertices) {
 		auto curBvhNodes = this->createBvhData(curPrimitives, vertices);
+		this->bvhHeight = std::max(this->bvhHeight, nugiEngine::bvhHeight(*curBvhNodes));
 
 		for (int i = 0; i < curBvhNodes->size(); i++) {
 			this->bvhNodes->emplace_back(curBvhNodes->at(i));
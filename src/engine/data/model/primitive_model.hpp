@@ -23,6 +23,7 @@ namespace nugiEngine {
 
       uint32_t getPrimitiveSize() const { return static_cast<uint32_t>(this->primitives->size()); }
       uint32_t getBvhSize() const { return static_cast<uint32_t>(this->bvhNodes->size()); }
+      uint32_t getBvhHeight() const { return this->bvhHeight; }
 
       void addPrimitive(std::shared_ptr<std::vector<Primitive>> primitives, std::shared_ptr<std::vector<RayTraceVertex>> vertices);
       void createBuffers();
@@ -34,6 +35,9 @@ namespace nugiEngine {
 
       std::shared_ptr<std::vector<Primitive>> primitives{};
       std::shared_ptr<std::vector<BvhNode>> bvhNodes{};
+
+      // Of the tallest BVH added so far, every object traverses its own
+      uint32_t bvhHeight = 0u;
       
       std::shared_ptr<EngineBuffer> primitiveBuffer;
       std::shared_ptr<EngineBuffer> bvhBuffer;
@@ -24,6 +24,7 @@ namespace nugiEngine {
     uint32_t firstBvhIndex = 0u;
     uint32_t firstPrimitiveIndex = 0u;
     uint32_t transformIndex = 0u;
+    uint32_t isEmissive = 0u;
   };
 
   struct TriangleLight {
@@ -73,57 +74,26 @@ namespace nugiEngine {
     alignas(16) glm::vec3 direction{0.0f};
   };
 
-  struct RayData {
-    Ray ray{};
-
-    float dirMin = 0.001f;
-    alignas(16) glm::vec3 dirMax{1000000.0f};
-
-    uint32_t rayBounce = 0u;
-  };
-
-  struct HitRecord {
-    bool isHit = false;
-    uint32_t rayBounce = 0u;
-
-    uint32_t hitIndex = 0u;
-    uint32_t materialIndex = 0u;
-
-    alignas(16) glm::vec3 point{0.0f};
-    alignas(16) glm::vec3 dir{0.0f};
-    alignas(16) glm::vec3 normal{0.0f};
-    alignas(16) glm::vec2 uv{0.0f};
-  };
+  struct ShadeRecord {
+    Ray nextRay{};
 
-  struct IndirectShadeRecord {
-    bool isIlluminate = false;
     alignas(16) glm::vec3 radiance{0.0f};
+    uint32_t flags = 0u;
     float pdf = 0.0f;
-
-    Ray nextRay{};
   };
 
   struct DirectShadeRecord {
     bool isIlluminate = false;
     alignas(16) glm::vec3 radiance{0.0f};
     float pdf = 0.0f;
-  };
-
-  struct LightShadeRecord {
-    bool isIlluminate = false;
-    alignas(16) glm::vec3 radiance{0.0f};
-    uint32_t rayBounce = 0u;
-  };
-
-  struct MissRecord {
-    bool isMiss = false;
-    alignas(16) glm::vec3 radiance{0.0f};
+    float bsdfPdf = 0.0f;
   };
 
   struct IndirectSamplerData {
     uint32_t xCoord = 0u;
     uint32_t yCoord = 0u;
     uint32_t rayBounce = 0u;
+    uint32_t sampleIndex = 0u;
 
     Ray nextRay{};
   };
@@ -131,7 +101,10 @@ namespace nugiEngine {
   struct DirectData {
     bool isIlluminate = false;
     uint32_t materialIndex = 0u;
-    alignas(16) glm::vec3 normal{0.0f};
+    uint32_t lightIndex = 0u;
+    uint32_t normal = 0u;
+
+    alignas(16) glm::vec3 lightDir{0.0f};
     alignas(16) glm::vec2 uv{0.0f};
   };
 
@@ -139,6 +112,28 @@ namespace nugiEngine {
     alignas(16) glm::vec3 totalIndirect{1.0f};
     alignas(16) glm::vec3 totalRadiance{0.0f};
     float pdf = 0.0f;
+
+    // Paths of the slot that ended since the result image was last written
+    alignas(16) glm::vec3 finishedRadiance{0.0f};
+    uint32_t finishedCount = 0u;
+    float finishedSquareLuminance = 0.0f;
+  };
+
+  // Running mean and Welford sum of squared luminance deviations over every path a pixel finished since the last reset
+  struct PixelStatistics {
+    alignas(16) glm::vec3 mean{0.0f};
+    uint32_t sampleCount = 0u;
+    float meanLuminance = 0.0f;
+    float m2 = 0.0f;
+    uint32_t isActive = 1u;
+  };
+
+  // What the camera ray of the pixel's first path slot hit, the edges the denoiser must not blur across
+  struct PixelGuide {
+    alignas(16) glm::vec3 normal{0.0f};
+    float depth = 0.0f;
+    alignas(16) glm::vec3 albedo{1.0f};
+    uint32_t isHit = 0u;
   };
 
   struct RayTraceUbo {
@@ -150,9 +145,58 @@ namespace nugiEngine {
     uint32_t numLights = 0u;
     SunLight sunLight;
     alignas(16) glm::vec3 skyColor{0.0f};
+
+    // Camera of the frame before, only read when the accumulated history is reprojected after a move
+    alignas(16) glm::vec3 previousOrigin{0.0f};
+    alignas(16) glm::vec3 previousHorizontal{0.0f};
+    alignas(16) glm::vec3 previousVertical{0.0f};
+    alignas(16) glm::vec3 previousLowerLeftCorner{0.0f};
   };
 
   struct RayTracePushConstant {
     uint32_t randomSeed = 0u;
   };
+
+  struct IndirectSamplerPushConstant {
+    uint32_t randomSeed = 0u;
+    uint32_t isPathRestart = 0u;
+  };
+
+  struct IntegratorPushConstant {
+    uint32_t randomSeed = 0u;
+    uint32_t isLastBounce = 1u;
+    uint32_t isPathRestart = 0u;
+    uint32_t imageWidth = 0u;
+  };
+
+  struct RaySortPushConstant {
+    uint32_t isIdentityOrder = 0u;
+  };
+
+  struct AdaptiveMaskPushConstant {
+    uint32_t randomSeed = 0u;
+    uint32_t minSampleCount = 0u;
+    float errorThreshold = 0.0f;
+  };
+
+  struct ReprojectPushConstant {
+    uint32_t maxHistoryCount = 0u;
+  };
+
+  struct DenoisePushConstant {
+    uint32_t stepSize = 1u;
+    uint32_t isLastIteration = 0u;
+    uint32_t imageWidth = 0u;
+    uint32_t imageHeight = 0u;
+  };
+
+  struct TonemapPushConstant {
+    uint32_t isDenoised = 0u;
+    float exposure = 1.0f;
+  };
+
+  struct ImageErrorPushConstant {
+    uint32_t isReferenceCapture = 0u;
+    uint32_t isDenoised = 0u;
+  };
 }
\ No newline at end of file
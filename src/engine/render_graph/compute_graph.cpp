@@ -0,0 +1,279 @@
+#include "compute_graph.hpp"
+
+#include <iostream>
+#include <unordered_set>
+
+namespace nugiEngine {
+	namespace {
+		struct BufferUse {
+			VkPipelineStageFlags stageMask = 0;
+			VkAccessFlags accessMask = 0;
+			bool isRead = false;
+			bool isWrite = false;
+		};
+
+		BufferUse getBufferUse(EngineGraphAccessType type) {
+			switch (type) {
+				case EngineGraphAccessType::Read:
+					return BufferUse{ VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT, true, false };
+
+				case EngineGraphAccessType::Write:
+					return BufferUse{ VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT, false, true };
+
+				case EngineGraphAccessType::ReadWrite:
+					return BufferUse{ VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, true, true };
+
+				case EngineGraphAccessType::Indirect:
+					return BufferUse{ VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, true, false };
+
+				case EngineGraphAccessType::TransferRead:
+					return BufferUse{ VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT, true, false };
+
+				case EngineGraphAccessType::TransferWrite:
+					return BufferUse{ VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, false, true };
+			}
+
+			return BufferUse{};
+		}
+	}
+
+	void EngineComputeGraph::addStage(std::vector<EngineGraphAccess> accesses, RecordFunction record) {
+		Stage stage{};
+		stage.accesses = accesses;
+		stage.record = record;
+
+		this->stages.emplace_back(stage);
+	}
+
+	// The result leaves the graph through something it does not track, like an image, so the stage is always kept
+	void EngineComputeGraph::addOutputStage(std::vector<EngineGraphAccess> accesses, RecordFunction record) {
+		Stage stage{};
+		stage.accesses = accesses;
+		stage.record = record;
+		stage.isOutput = true;
+
+		this->stages.emplace_back(stage);
+	}
+
+	// Buffers that must stay valid after the frame, like the path state carried into the next frame
+	void EngineComputeGraph::markOutput(std::vector<VkDescriptorBufferInfo> buffersInfo) {
+		this->outputs.emplace_back(buffersInfo);
+	}
+
+	// The first graph compiled against a transient allocator gives its buffers their memory, the barriers need to know which ones alias.
+	// A graph compiled later may still use the allocator's buffers, as long as it touches none of the transient ones
+	void EngineComputeGraph::compile(EngineTransientAllocator *transientAllocator) {
+		this->cullStages();
+
+		if (transientAllocator != nullptr) {
+			this->markTransientUses(*transientAllocator);
+
+			if (!transientAllocator->isAllocated()) {
+				transientAllocator->allocate();
+			}
+		}
+
+		this->frameBarriers.clear();
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			this->frameBarriers.emplace_back(this->buildBarriers(i, transientAllocator));
+		}
+
+		uint32_t bufferBarrierCount = 0;
+		for (auto &&stageBarrier : this->frameBarriers[0]) {
+			bufferBarrierCount += static_cast<uint32_t>(stageBarrier.bufferBarriers.size());
+		}
+
+		std::cout << "Compute graph: " << this->getLiveStageCount() << " of " << this->getStageCount() << " stages live, " 
+			<< this->getBarrierCount(0) << " barrier calls with " << bufferBarrierCount << " buffer barriers per frame" << std::endl;
+	}
+
+	void EngineComputeGraph::execute(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex) {
+		auto &stageBarriers = this->frameBarriers[frameIndex];
+
+		for (size_t i = 0; i < this->stages.size(); i++) {
+			if (!this->stages[i].isLive) {
+				continue;
+			}
+
+			auto &stageBarrier = stageBarriers[i];
+			if (stageBarrier.srcStageMask != 0) {
+				VkMemoryBarrier memoryBarrier{};
+				memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+				memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+				memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+
+				vkCmdPipelineBarrier(commandBuffer->getCommandBuffer(), stageBarrier.srcStageMask, stageBarrier.dstStageMask, 0, 
+					stageBarrier.hasAliasBarrier ? 1 : 0, stageBarrier.hasAliasBarrier ? &memoryBarrier : nullptr, 
+					static_cast<uint32_t>(stageBarrier.bufferBarriers.size()), stageBarrier.bufferBarriers.data(), 0, nullptr);
+			}
+
+			this->stages[i].record(commandBuffer, frameIndex);
+		}
+	}
+
+	uint32_t EngineComputeGraph::getLiveStageCount() const {
+		uint32_t liveCount = 0;
+		for (auto &&stage : this->stages) {
+			liveCount += stage.isLive ? 1 : 0;
+		}
+
+		return liveCount;
+	}
+
+	uint32_t EngineComputeGraph::getBarrierCount(uint32_t frameIndex) const {
+		uint32_t barrierCount = 0;
+		for (size_t i = 0; i < this->stages.size(); i++) {
+			barrierCount += this->stages[i].isLive && this->frameBarriers[frameIndex][i].srcStageMask != 0 ? 1 : 0;
+		}
+
+		return barrierCount;
+	}
+
+	// Walks the stages backward: a stage is live only if it writes a buffer that an output or a later live stage needs
+	void EngineComputeGraph::cullStages() {
+		std::unordered_set<VkBuffer> neededBuffers;
+		for (auto &&output : this->outputs) {
+			for (auto &&bufferInfo : output) {
+				neededBuffers.insert(bufferInfo.buffer);
+			}
+		}
+
+		for (auto stage = this->stages.rbegin(); stage != this->stages.rend(); stage++) {
+			stage->isLive = stage->isOutput;
+
+			for (auto &&access : stage->accesses) {
+				if (!getBufferUse(access.type).isWrite) {
+					continue;
+				}
+
+				for (auto &&bufferInfo : access.buffersInfo) {
+					stage->isLive = stage->isLive || neededBuffers.count(bufferInfo.buffer) > 0;
+				}
+			}
+
+			if (!stage->isLive) {
+				continue;
+			}
+
+			for (auto &&access : stage->accesses) {
+				if (!getBufferUse(access.type).isRead) {
+					continue;
+				}
+
+				for (auto &&bufferInfo : access.buffersInfo) {
+					neededBuffers.insert(bufferInfo.buffer);
+				}
+			}
+		}
+	}
+
+	// Culled stages never run, so they do not keep a buffer alive
+	void EngineComputeGraph::markTransientUses(EngineTransientAllocator &transientAllocator) const {
+		for (size_t i = 0; i < this->stages.size(); i++) {
+			if (!this->stages[i].isLive) {
+				continue;
+			}
+
+			for (auto &&access : this->stages[i].accesses) {
+				for (auto &&bufferInfo : access.buffersInfo) {
+					transientAllocator.markUse(bufferInfo.buffer, static_cast<uint32_t>(i));
+				}
+			}
+		}
+	}
+
+	// The frame is simulated twice so the first stages also see the hazards left by the end of the previous frame
+	std::vector<EngineComputeGraph::StageBarrier> EngineComputeGraph::buildBarriers(uint32_t frameIndex, const EngineTransientAllocator *transientAllocator) {
+		std::unordered_map<VkBuffer, BufferState> bufferStates;
+		std::vector<StageBarrier> stageBarriers(this->stages.size());
+
+		for (uint32_t pass = 0; pass < 2; pass++) {
+			for (auto &&bufferState : bufferStates) {
+				bufferState.second.isTouched = false;
+			}
+
+			for (size_t i = 0; i < this->stages.size(); i++) {
+				if (!this->stages[i].isLive) {
+					continue;
+				}
+
+				// Several accesses of a stage to the same buffer are merged into one use
+				std::unordered_map<VkBuffer, BufferUse> stageUses;
+				std::vector<VkBuffer> stageBuffers;
+
+				for (auto &&access : this->stages[i].accesses) {
+					BufferUse use = getBufferUse(access.type);
+					VkBuffer buffer = access.buffersInfo[frameIndex].buffer;
+
+					if (stageUses.count(buffer) == 0) {
+						stageBuffers.emplace_back(buffer);
+					}
+
+					auto &stageUse = stageUses[buffer];
+					stageUse.stageMask |= use.stageMask;
+					stageUse.accessMask |= use.accessMask;
+					stageUse.isRead = stageUse.isRead || use.isRead;
+					stageUse.isWrite = stageUse.isWrite || use.isWrite;
+				}
+
+				StageBarrier stageBarrier{};
+
+				for (auto &&buffer : stageBuffers) {
+					auto &use = stageUses[buffer];
+					auto &state = bufferStates[buffer];
+
+					VkPipelineStageFlags srcStageMask = 0;
+					VkAccessFlags srcAccessMask = 0;
+
+					if (use.isWrite) {
+						// Write after read only needs the readers to finish, write after write also needs their data flushed
+						srcStageMask = state.readStageMask | state.writeStageMask;
+						srcAccessMask = state.writeAccessMask;
+					} else if (state.writeStageMask != 0 && ((use.stageMask & ~state.readStageMask) != 0 || (use.accessMask & ~state.readAccessMask) != 0)) {
+						// Read after write, unless an earlier barrier already made the write visible to this kind of read
+						srcStageMask = state.writeStageMask;
+						srcAccessMask = state.writeAccessMask;
+					}
+
+					if (!state.isTouched && transientAllocator != nullptr && transientAllocator->isAliased(buffer)) {
+						stageBarrier.hasAliasBarrier = true;
+						stageBarrier.srcStageMask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+						stageBarrier.dstStageMask |= use.stageMask;
+					}
+
+					if (srcStageMask != 0) {
+						VkBufferMemoryBarrier bufferBarrier{};
+						bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+						bufferBarrier.srcAccessMask = srcAccessMask;
+						bufferBarrier.dstAccessMask = use.accessMask;
+						bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+						bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+						bufferBarrier.buffer = buffer;
+						bufferBarrier.offset = 0;
+						bufferBarrier.size = VK_WHOLE_SIZE;
+
+						stageBarrier.srcStageMask |= srcStageMask;
+						stageBarrier.dstStageMask |= use.stageMask;
+						stageBarrier.bufferBarriers.emplace_back(bufferBarrier);
+					}
+
+					if (use.isWrite) {
+						state.writeStageMask = use.stageMask;
+						state.writeAccessMask = use.accessMask & (VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+						state.readStageMask = 0;
+						state.readAccessMask = 0;
+					} else {
+						state.readStageMask |= use.stageMask;
+						state.readAccessMask |= use.accessMask;
+					}
+
+					state.isTouched = true;
+				}
+
+				stageBarriers[i] = stageBarrier;
+			}
+		}
+
+		return stageBarriers;
+	}
+} // namespace nugiEngine
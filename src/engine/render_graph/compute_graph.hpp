@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../../vulkan/device/device.hpp"
+#include "../../vulkan/command/command_buffer.hpp"
+#include "../../vulkan/buffer/transient_allocator.hpp"
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace nugiEngine {
+	enum class EngineGraphAccessType {
+		Read,
+		Write,
+		ReadWrite,
+		Indirect,
+		TransferRead,
+		TransferWrite
+	};
+
+	struct EngineGraphAccess {
+		std::vector<VkDescriptorBufferInfo> buffersInfo;
+		EngineGraphAccessType type;
+	};
+
+	// Compute stages that declare which buffers they read and write. The graph derives the barriers between stages,
+	// batches all of a stage's barriers into one vkCmdPipelineBarrier and drops stages whose writes nobody reads
+	class EngineComputeGraph {
+		public:
+			using RecordFunction = std::function<void(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex)>;
+
+			void addStage(std::vector<EngineGraphAccess> accesses, RecordFunction record);
+			void addOutputStage(std::vector<EngineGraphAccess> accesses, RecordFunction record);
+			void markOutput(std::vector<VkDescriptorBufferInfo> buffersInfo);
+
+			void compile(EngineTransientAllocator *transientAllocator = nullptr);
+			void execute(std::shared_ptr<EngineCommandBuffer> commandBuffer, uint32_t frameIndex);
+
+			uint32_t getStageCount() const { return static_cast<uint32_t>(this->stages.size()); }
+			uint32_t getLiveStageCount() const;
+			uint32_t getBarrierCount(uint32_t frameIndex) const;
+
+		private:
+			struct Stage {
+				std::vector<EngineGraphAccess> accesses;
+				RecordFunction record;
+				bool isLive = true;
+				bool isOutput = false;
+			};
+
+			struct StageBarrier {
+				VkPipelineStageFlags srcStageMask = 0;
+				VkPipelineStageFlags dstStageMask = 0;
+				std::vector<VkBufferMemoryBarrier> bufferBarriers;
+				bool hasAliasBarrier = false;
+			};
+
+			// Accesses to one buffer since its last write, used to find the hazards of the next access
+			struct BufferState {
+				VkPipelineStageFlags writeStageMask = 0;
+				VkAccessFlags writeAccessMask = 0;
+				VkPipelineStageFlags readStageMask = 0;
+				VkAccessFlags readAccessMask = 0;
+				bool isTouched = false;
+			};
+
+			std::vector<Stage> stages;
+			std::vector<std::vector<VkDescriptorBufferInfo>> outputs;
+			std::vector<std::vector<StageBarrier>> frameBarriers;
+
+			void cullStages();
+			void markTransientUses(EngineTransientAllocator &transientAllocator) const;
+			std::vector<StageBarrier> buildBarriers(uint32_t frameIndex, const EngineTransientAllocator *transientAllocator);
+	};
+} // namespace nugiEngine
@@ -50,7 +50,7 @@ namespace nugiEngine {
 				.setMaxSets(100)
 				.addPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 100)
 				.addPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 100)
-				.addPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 100)
+				.addPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 200)
 				.build();
 	}
 
@@ -113,7 +113,7 @@ namespace nugiEngine {
 
 		std::vector<VkSemaphore> waitSemaphores = {this->imageAvailableSemaphores[this->currentFrameIndex]};
 		std::vector<VkSemaphore> signalSemaphores = {this->renderFinishedSemaphores[this->currentFrameIndex]};
-		std::vector<VkPipelineStageFlags> waitStages = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+		std::vector<VkPipelineStageFlags> waitStages = { VK_PIPELINE_STAGE_TRANSFER_BIT };
 
 		EngineCommandBuffer::submitCommands(commandBuffers, this->appDevice.getGraphicsQueue(this->currentFrameIndex), waitSemaphores, waitStages, signalSemaphores, this->inFlightFences[this->currentFrameIndex]);
 	}
@@ -124,7 +124,8 @@ namespace nugiEngine {
 
 		std::vector<VkSemaphore> waitSemaphores = {this->imageAvailableSemaphores[this->currentFrameIndex]};
 		std::vector<VkSemaphore> signalSemaphores = {this->renderFinishedSemaphores[this->currentFrameIndex]};
-		std::vector<VkPipelineStageFlags> waitStages = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+		// The swapchain image is first touched by the copy of the traced image, the compute work before it need not wait
+		std::vector<VkPipelineStageFlags> waitStages = { VK_PIPELINE_STAGE_TRANSFER_BIT };
 
 		commandBuffer->submitCommand(this->appDevice.getGraphicsQueue(this->currentFrameIndex), waitSemaphores, waitStages, signalSemaphores, this->inFlightFences[this->currentFrameIndex]);
 	}
@@ -0,0 +1,78 @@
+#include "adaptive_mask_render_system.hpp"
+
+#include <stdexcept>
+#include <array>
+#include <string>
+
+namespace nugiEngine {
+	EngineAdaptiveMaskRenderSystem::EngineAdaptiveMaskRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, kernelConfig{kernelConfig}
+	{
+		this->createPipelineLayout(descriptorSetLayouts);
+		this->createPipeline();
+	}
+
+	EngineAdaptiveMaskRenderSystem::~EngineAdaptiveMaskRenderSystem() {
+		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
+	}
+
+	void EngineAdaptiveMaskRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
+		VkPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(AdaptiveMaskPushConstant);
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayouts;
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+		if (vkCreatePipelineLayout(this->appDevice.getLogicalDevice(), &pipelineLayoutInfo, nullptr, &this->pipelineLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create pipeline layout!");
+		}
+	}
+
+	void EngineAdaptiveMaskRenderSystem::createPipeline() {
+		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
+
+		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault(subgroupShaderPath("adaptive_mask", this->kernelConfig))
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.build();
+	}
+
+	void EngineAdaptiveMaskRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed, uint32_t minSampleCount, float errorThreshold) {
+		this->pipeline->bind(commandBuffer->getCommandBuffer());
+
+		vkCmdBindDescriptorSets(
+			commandBuffer->getCommandBuffer(),
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			this->pipelineLayout,
+			0,
+			1,
+			&descriptorSets,
+			0,
+			nullptr
+		);
+
+		AdaptiveMaskPushConstant pushConstant{};
+		pushConstant.randomSeed = randomSeed;
+		pushConstant.minSampleCount = minSampleCount;
+		pushConstant.errorThreshold = errorThreshold;
+
+		vkCmdPushConstants(
+			commandBuffer->getCommandBuffer(), 
+			this->pipelineLayout, 
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			sizeof(AdaptiveMaskPushConstant),
+			&pushConstant
+		);
+
+		// The pixel count need not be a multiple of the workgroup size, the kernel skips the invocations past the last pixel
+		uint32_t numPixels = this->width * this->height;
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (numPixels + this->kernelConfig.workGroupSize - 1u) / this->kernelConfig.workGroupSize, 1u, 1u);
+	}
+}
\ No newline at end of file
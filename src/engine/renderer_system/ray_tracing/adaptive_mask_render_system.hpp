@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../../../vulkan/command/command_buffer.hpp"
+#include "../../../vulkan/device/device.hpp"
+#include "../../../vulkan/pipeline/compute_pipeline.hpp"
+#include "../../../vulkan/buffer/buffer.hpp"
+#include "../../../vulkan/descriptor/descriptor.hpp"
+#include "../../../vulkan/swap_chain/swap_chain.hpp"
+#include "../../utils/camera/camera.hpp"
+#include "../../utils/kernel/kernel_config.hpp"
+#include "../../ray_ubo.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace nugiEngine {
+	// One invocation per pixel rather than per path slot, it only reads and writes the pixel statistics
+	class EngineAdaptiveMaskRenderSystem {
+		public:
+			EngineAdaptiveMaskRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, const KernelConfig& kernelConfig);
+			~EngineAdaptiveMaskRenderSystem();
+
+			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed, uint32_t minSampleCount, float errorThreshold);
+
+		private:
+			void createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts);
+			void createPipeline();
+
+			EngineDevice& appDevice;
+			
+			VkPipelineLayout pipelineLayout;
+			std::unique_ptr<EngineComputePipeline> pipeline;
+
+			uint32_t width, height;
+			KernelConfig kernelConfig;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "denoise_render_system.hpp"
+
+#include <stdexcept>
+#include <array>
+#include <string>
+
+namespace nugiEngine {
+	EngineDenoiseRenderSystem::EngineDenoiseRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, kernelConfig{kernelConfig}
+	{
+		this->createPipelineLayout(descriptorSetLayouts);
+		this->createPipeline();
+	}
+
+	EngineDenoiseRenderSystem::~EngineDenoiseRenderSystem() {
+		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
+	}
+
+	void EngineDenoiseRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
+		VkPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(DenoisePushConstant);
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayouts;
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+		if (vkCreatePipelineLayout(this->appDevice.getLogicalDevice(), &pipelineLayoutInfo, nullptr, &this->pipelineLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create pipeline layout!");
+		}
+	}
+
+	// Both kernels share the layout, demodulation just leaves the push constant unused
+	void EngineDenoiseRenderSystem::createPipeline() {
+		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
+
+		this->demodulatePipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault("shader/denoise_demodulate.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.build();
+
+		this->atrousPipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault("shader/denoise_atrous.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.build();
+	}
+
+	void EngineDenoiseRenderSystem::bindPipeline(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, EngineComputePipeline* pipeline) {
+		pipeline->bind(commandBuffer->getCommandBuffer());
+
+		vkCmdBindDescriptorSets(
+			commandBuffer->getCommandBuffer(),
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			this->pipelineLayout,
+			0,
+			1,
+			&descriptorSets,
+			0,
+			nullptr
+		);
+	}
+
+	// One invocation per pixel, the kernels skip the ones past the last pixel
+	void EngineDenoiseRenderSystem::dispatchPixels(std::shared_ptr<EngineCommandBuffer> commandBuffer, EngineComputePipeline* pipeline) {
+		uint32_t numPixels = this->width * this->height;
+		pipeline->dispatch(commandBuffer->getCommandBuffer(), (numPixels + this->kernelConfig.workGroupSize - 1u) / this->kernelConfig.workGroupSize, 1u, 1u);
+	}
+
+	void EngineDenoiseRenderSystem::renderDemodulate(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets) {
+		this->bindPipeline(commandBuffer, descriptorSets, this->demodulatePipeline.get());
+		this->dispatchPixels(commandBuffer, this->demodulatePipeline.get());
+	}
+
+	void EngineDenoiseRenderSystem::renderAtrous(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t stepSize, bool isLastIteration) {
+		this->bindPipeline(commandBuffer, descriptorSets, this->atrousPipeline.get());
+
+		DenoisePushConstant pushConstant{};
+		pushConstant.stepSize = stepSize;
+		pushConstant.isLastIteration = isLastIteration ? 1u : 0u;
+		pushConstant.imageWidth = this->width;
+		pushConstant.imageHeight = this->height;
+
+		vkCmdPushConstants(
+			commandBuffer->getCommandBuffer(), 
+			this->pipelineLayout, 
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			sizeof(DenoisePushConstant),
+			&pushConstant
+		);
+
+		this->dispatchPixels(commandBuffer, this->atrousPipeline.get());
+	}
+}
\ No newline at end of file
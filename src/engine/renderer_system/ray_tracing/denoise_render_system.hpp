@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../../../vulkan/command/command_buffer.hpp"
+#include "../../../vulkan/device/device.hpp"
+#include "../../../vulkan/pipeline/compute_pipeline.hpp"
+#include "../../../vulkan/buffer/buffer.hpp"
+#include "../../../vulkan/descriptor/descriptor.hpp"
+#include "../../../vulkan/swap_chain/swap_chain.hpp"
+#include "../../utils/camera/camera.hpp"
+#include "../../utils/kernel/kernel_config.hpp"
+#include "../../ray_ubo.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace nugiEngine {
+	class EngineDenoiseRenderSystem {
+		public:
+			EngineDenoiseRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, const KernelConfig& kernelConfig);
+			~EngineDenoiseRenderSystem();
+
+			void renderDemodulate(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets);
+			void renderAtrous(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t stepSize, bool isLastIteration);
+
+		private:
+			void createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts);
+			void createPipeline();
+			void bindPipeline(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, EngineComputePipeline* pipeline);
+			void dispatchPixels(std::shared_ptr<EngineCommandBuffer> commandBuffer, EngineComputePipeline* pipeline);
+
+			EngineDevice& appDevice;
+			
+			VkPipelineLayout pipelineLayout;
+			std::unique_ptr<EngineComputePipeline> demodulatePipeline;
+			std::unique_ptr<EngineComputePipeline> atrousPipeline;
+
+			uint32_t width, height;
+			KernelConfig kernelConfig;
+	};
+}
\ No newline at end of file
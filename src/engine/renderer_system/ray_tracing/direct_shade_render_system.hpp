@@ -7,6 +7,7 @@
 #include "../../../vulkan/descriptor/descriptor.hpp"
 #include "../../../vulkan/swap_chain/swap_chain.hpp"
 #include "../../utils/camera/camera.hpp"
+#include "../../utils/kernel/kernel_config.hpp"
 #include "../../ray_ubo.hpp"
 
 #include <memory>
@@ -15,7 +16,7 @@
 namespace nugiEngine {
 	class EngineDirectShadeRenderSystem {
 		public:
-			EngineDirectShadeRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample);
+			EngineDirectShadeRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const KernelConfig& kernelConfig);
 			~EngineDirectShadeRenderSystem();
 
 			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed = 1);
@@ -30,5 +31,6 @@ namespace nugiEngine {
 			std::unique_ptr<EngineComputePipeline> pipeline;
 
 			uint32_t width, height, nSample;
+			KernelConfig kernelConfig;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "image_error_render_system.hpp"
+
+#include <stdexcept>
+#include <array>
+#include <string>
+
+namespace nugiEngine {
+	EngineImageErrorRenderSystem::EngineImageErrorRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, kernelConfig{kernelConfig}
+	{
+		this->createPipelineLayout(descriptorSetLayouts);
+		this->createPipeline();
+	}
+
+	EngineImageErrorRenderSystem::~EngineImageErrorRenderSystem() {
+		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
+	}
+
+	void EngineImageErrorRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
+		VkPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(ImageErrorPushConstant);
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayouts;
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+		if (vkCreatePipelineLayout(this->appDevice.getLogicalDevice(), &pipelineLayoutInfo, nullptr, &this->pipelineLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create pipeline layout!");
+		}
+	}
+
+	void EngineImageErrorRenderSystem::createPipeline() {
+		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
+
+		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault("shader/image_error.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.build();
+	}
+
+	void EngineImageErrorRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, bool isReferenceCapture, bool isDenoised) {
+		this->pipeline->bind(commandBuffer->getCommandBuffer());
+
+		vkCmdBindDescriptorSets(
+			commandBuffer->getCommandBuffer(),
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			this->pipelineLayout,
+			0,
+			1,
+			&descriptorSets,
+			0,
+			nullptr
+		);
+
+		ImageErrorPushConstant pushConstant{};
+		pushConstant.isReferenceCapture = isReferenceCapture ? 1u : 0u;
+		pushConstant.isDenoised = isDenoised ? 1u : 0u;
+
+		vkCmdPushConstants(
+			commandBuffer->getCommandBuffer(), 
+			this->pipelineLayout, 
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			sizeof(ImageErrorPushConstant),
+			&pushConstant
+		);
+
+		uint32_t numPixels = this->width * this->height;
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (numPixels + this->kernelConfig.workGroupSize - 1u) / this->kernelConfig.workGroupSize, 1u, 1u);
+	}
+}
\ No newline at end of file
@@ -10,8 +10,8 @@
 #include <string>
 
 namespace nugiEngine {
-	EngineIndirectSamplerRenderSystem::EngineIndirectSamplerRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample) 
-		: appDevice{device}, width{width}, height{height}, nSample{nSample}
+	EngineIndirectSamplerRenderSystem::EngineIndirectSamplerRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, nSample{nSample}, kernelConfig{kernelConfig}
 	{
 		this->createPipelineLayout(descriptorSetLayouts);
 		this->createPipeline();
@@ -25,7 +25,7 @@ namespace nugiEngine {
 		VkPushConstantRange pushConstantRange{};
 		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
 		pushConstantRange.offset = 0;
-		pushConstantRange.size = sizeof(RayTracePushConstant);
+		pushConstantRange.size = sizeof(IndirectSamplerPushConstant);
 
 		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
 		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -44,10 +44,12 @@ namespace nugiEngine {
 
 		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
 			.setDefault("shader/indirect_sampler.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.addSpecializationConstant(SAMPLE_SEQUENCE_CONSTANT_ID, this->kernelConfig.sampleSequence)
 			.build();
 	}
 
-	void EngineIndirectSamplerRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed) {
+	void EngineIndirectSamplerRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed, bool isPathRestart) {
 		this->pipeline->bind(commandBuffer->getCommandBuffer());
 
 		vkCmdBindDescriptorSets(
@@ -61,18 +63,19 @@ namespace nugiEngine {
 			nullptr
 		);
 
-		RayTracePushConstant pushConstant{};
+		IndirectSamplerPushConstant pushConstant{};
 		pushConstant.randomSeed = randomSeed;
+		pushConstant.isPathRestart = isPathRestart ? 1u : 0u;
 
 		vkCmdPushConstants(
 			commandBuffer->getCommandBuffer(), 
 			this->pipelineLayout, 
 			VK_SHADER_STAGE_COMPUTE_BIT,
 			0,
-			sizeof(RayTracePushConstant),
+			sizeof(IndirectSamplerPushConstant),
 			&pushConstant
 		);
 
-		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / 32u, 1u, 1u);
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / this->kernelConfig.workGroupSize, 1u, 1u);
 	}
 }
\ No newline at end of file
@@ -10,8 +10,8 @@
 #include <string>
 
 namespace nugiEngine {
-	EngineIndirectShadeRenderSystem::EngineIndirectShadeRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample) 
-		: appDevice{device}, width{width}, height{height}, nSample{nSample}
+	EngineIndirectShadeRenderSystem::EngineIndirectShadeRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, nSample{nSample}, kernelConfig{kernelConfig}
 	{
 		this->createPipelineLayout(descriptorSetLayouts);
 		this->createPipeline();
@@ -44,6 +44,8 @@ namespace nugiEngine {
 
 		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
 			.setDefault("shader/indirect_shade.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.addSpecializationConstant(SAMPLE_SEQUENCE_CONSTANT_ID, this->kernelConfig.sampleSequence)
 			.build();
 	}
 
@@ -73,6 +75,6 @@ namespace nugiEngine {
 			&pushConstant
 		);
 
-		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / 32u, 1u, 1u);
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / this->kernelConfig.workGroupSize, 1u, 1u);
 	}
 }
\ No newline at end of file
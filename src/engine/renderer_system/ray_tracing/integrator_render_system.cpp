@@ -10,8 +10,8 @@
 #include <string>
 
 namespace nugiEngine {
-	EngineIntegratorRenderSystem::EngineIntegratorRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample) 
-		: appDevice{device}, width{width}, height{height}, nSample{nSample}
+	EngineIntegratorRenderSystem::EngineIntegratorRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, nSample{nSample}, kernelConfig{kernelConfig}
 	{
 		this->createPipelineLayout(descriptorSetLayouts);
 		this->createPipeline();
@@ -25,7 +25,7 @@ namespace nugiEngine {
 		VkPushConstantRange pushConstantRange{};
 		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
 		pushConstantRange.offset = 0;
-		pushConstantRange.size = sizeof(RayTracePushConstant);
+		pushConstantRange.size = sizeof(IntegratorPushConstant);
 
 		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
 		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -44,10 +44,16 @@ namespace nugiEngine {
 
 		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
 			.setDefault("shader/integrator.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.addSpecializationConstant(MAX_BOUNCE_CONSTANT_ID, this->kernelConfig.maxBounce)
+			.addSpecializationConstant(ROULETTE_START_BOUNCE_CONSTANT_ID, this->kernelConfig.rouletteStartBounce)
+			.addSpecializationConstant(LIGHT_FLAGS_CONSTANT_ID, this->kernelConfig.lightFlags)
+			.addSpecializationConstant(SAMPLE_SEQUENCE_CONSTANT_ID, this->kernelConfig.sampleSequence)
+			.addSpecializationConstant(SAMPLES_PER_PIXEL_CONSTANT_ID, this->kernelConfig.samplesPerPixel)
 			.build();
 	}
 
-	void EngineIntegratorRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed) {
+	void EngineIntegratorRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed, bool isLastBounce, bool isPathRestart) {
 		this->pipeline->bind(commandBuffer->getCommandBuffer());
 
 		vkCmdBindDescriptorSets(
@@ -61,18 +67,21 @@ namespace nugiEngine {
 			nullptr
 		);
 
-		RayTracePushConstant pushConstant{};
+		IntegratorPushConstant pushConstant{};
 		pushConstant.randomSeed = randomSeed;
+		pushConstant.isLastBounce = isLastBounce ? 1u : 0u;
+		pushConstant.isPathRestart = isPathRestart ? 1u : 0u;
+		pushConstant.imageWidth = this->width;
 
 		vkCmdPushConstants(
 			commandBuffer->getCommandBuffer(), 
 			this->pipelineLayout, 
 			VK_SHADER_STAGE_COMPUTE_BIT,
 			0,
-			sizeof(RayTracePushConstant),
+			sizeof(IntegratorPushConstant),
 			&pushConstant
 		);
 
-		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / 32u, 1u, 1u);
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / this->kernelConfig.workGroupSize, 1u, 1u);
 	}
 }
\ No newline at end of file
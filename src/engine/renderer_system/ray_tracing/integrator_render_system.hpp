@@ -7,6 +7,7 @@
 #include "../../../vulkan/descriptor/descriptor.hpp"
 #include "../../../vulkan/swap_chain/swap_chain.hpp"
 #include "../../utils/camera/camera.hpp"
+#include "../../utils/kernel/kernel_config.hpp"
 #include "../../ray_ubo.hpp"
 
 #include <memory>
@@ -15,10 +16,10 @@
 namespace nugiEngine {
 	class EngineIntegratorRenderSystem {
 		public:
-			EngineIntegratorRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample);
+			EngineIntegratorRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const KernelConfig& kernelConfig);
 			~EngineIntegratorRenderSystem();
 
-			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed = 1);
+			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed = 1, bool isLastBounce = true, bool isPathRestart = false);
 
 		private:
 			void createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts);
@@ -30,5 +31,6 @@ namespace nugiEngine {
 			std::unique_ptr<EngineComputePipeline> pipeline;
 
 			uint32_t width, height, nSample;
+			KernelConfig kernelConfig;
 	};
 }
\ No newline at end of file
@@ -1,54 +0,0 @@
-#include "intersect_light_render_system.hpp"
-
-#include <stdexcept>
-#include <array>
-#include <string>
-
-namespace nugiEngine {
-	EngineIntersectLightRenderSystem::EngineIntersectLightRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample) 
-		: appDevice{device}, width{width}, height{height}, nSample{nSample}
-	{
-		this->createPipelineLayout(descriptorSetLayouts);
-		this->createPipeline();
-	}
-
-	EngineIntersectLightRenderSystem::~EngineIntersectLightRenderSystem() {
-		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
-	}
-
-	void EngineIntersectLightRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
-		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
-		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-		pipelineLayoutInfo.setLayoutCount = 1;
-		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayouts;
-
-		if (vkCreatePipelineLayout(this->appDevice.getLogicalDevice(), &pipelineLayoutInfo, nullptr, &this->pipelineLayout) != VK_SUCCESS) {
-			throw std::runtime_error("failed to create pipeline layout!");
-		}
-	}
-
-	void EngineIntersectLightRenderSystem::createPipeline() {
-		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
-
-		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
-			.setDefault("shader/intersect_light.comp.spv")
-			.build();
-	}
-
-	void EngineIntersectLightRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets) {
-		this->pipeline->bind(commandBuffer->getCommandBuffer());
-
-		vkCmdBindDescriptorSets(
-			commandBuffer->getCommandBuffer(),
-			VK_PIPELINE_BIND_POINT_COMPUTE,
-			this->pipelineLayout,
-			0,
-			1,
-			&descriptorSets,
-			0,
-			nullptr
-		);
-
-		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / 32u, 1u, 1u);
-	}
-}
\ No newline at end of file
@@ -5,8 +5,8 @@
 #include <string>
 
 namespace nugiEngine {
-	EngineIntersectObjectRenderSystem::EngineIntersectObjectRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample) 
-		: appDevice{device}, width{width}, height{height}, nSample{nSample}
+	EngineIntersectObjectRenderSystem::EngineIntersectObjectRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, nSample{nSample}, kernelConfig{kernelConfig}
 	{
 		this->createPipelineLayout(descriptorSetLayouts);
 		this->createPipeline();
@@ -32,6 +32,10 @@ namespace nugiEngine {
 
 		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
 			.setDefault("shader/intersect_object.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.addSpecializationConstant(TRAVERSAL_STACK_SIZE_CONSTANT_ID, this->kernelConfig.traversalStackSize)
+			.addSpecializationConstant(TRAVERSAL_SPILL_SIZE_CONSTANT_ID, this->kernelConfig.traversalSpillSize)
+			.addSpecializationConstant(BACKFACE_CULLING_CONSTANT_ID, this->kernelConfig.isBackfaceCulling)
 			.build();
 	}
 
@@ -49,6 +53,6 @@ namespace nugiEngine {
 			nullptr
 		);
 
-		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / 32u, 1u, 1u);
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / this->kernelConfig.workGroupSize, 1u, 1u);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "intersect_shadow_render_system.hpp"
+
+#include <stdexcept>
+#include <array>
+#include <string>
+
+namespace nugiEngine {
+	EngineIntersectShadowRenderSystem::EngineIntersectShadowRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, const KernelConfig& kernelConfig) 
+		: appDevice{device}, kernelConfig{kernelConfig}
+	{
+		this->createPipelineLayout(descriptorSetLayouts);
+		this->createPipeline();
+	}
+
+	EngineIntersectShadowRenderSystem::~EngineIntersectShadowRenderSystem() {
+		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
+	}
+
+	void EngineIntersectShadowRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayouts;
+
+		if (vkCreatePipelineLayout(this->appDevice.getLogicalDevice(), &pipelineLayoutInfo, nullptr, &this->pipelineLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create pipeline layout!");
+		}
+	}
+
+	void EngineIntersectShadowRenderSystem::createPipeline() {
+		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
+
+		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault("shader/intersect_shadow.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.addSpecializationConstant(TRAVERSAL_STACK_SIZE_CONSTANT_ID, this->kernelConfig.traversalStackSize)
+			.addSpecializationConstant(TRAVERSAL_SPILL_SIZE_CONSTANT_ID, this->kernelConfig.traversalSpillSize)
+			.addSpecializationConstant(BACKFACE_CULLING_CONSTANT_ID, this->kernelConfig.isBackfaceCulling)
+			.build();
+	}
+
+	void EngineIntersectShadowRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, VkBuffer dispatchBuffer) {
+		this->pipeline->bind(commandBuffer->getCommandBuffer());
+
+		vkCmdBindDescriptorSets(
+			commandBuffer->getCommandBuffer(),
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			this->pipelineLayout,
+			0,
+			1,
+			&descriptorSets,
+			0,
+			nullptr
+		);
+
+		// Workgroup count is written by the samplers while they enqueue live shadow rays
+		this->pipeline->dispatchIndirect(commandBuffer->getCommandBuffer(), dispatchBuffer);
+	}
+}
\ No newline at end of file
@@ -7,18 +7,19 @@
 #include "../../../vulkan/descriptor/descriptor.hpp"
 #include "../../../vulkan/swap_chain/swap_chain.hpp"
 #include "../../utils/camera/camera.hpp"
+#include "../../utils/kernel/kernel_config.hpp"
 #include "../../ray_ubo.hpp"
 
 #include <memory>
 #include <vector>
 
 namespace nugiEngine {
-	class EngineIntersectLightRenderSystem {
+	class EngineIntersectShadowRenderSystem {
 		public:
-			EngineIntersectLightRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample);
-			~EngineIntersectLightRenderSystem();
+			EngineIntersectShadowRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, const KernelConfig& kernelConfig);
+			~EngineIntersectShadowRenderSystem();
 
-			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets);
+			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, VkBuffer dispatchBuffer);
 
 		private:
 			void createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts);
@@ -29,6 +30,6 @@ namespace nugiEngine {
 			VkPipelineLayout pipelineLayout;
 			std::unique_ptr<EngineComputePipeline> pipeline;
 
-			uint32_t width, height, nSample;
+			KernelConfig kernelConfig;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "megakernel_render_system.hpp"
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <stdexcept>
+#include <array>
+#include <string>
+
+namespace nugiEngine {
+	EngineMegakernelRenderSystem::EngineMegakernelRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, const KernelConfig& kernelConfig, uint32_t workGroupCount) 
+		: appDevice{device}, kernelConfig{kernelConfig}, workGroupCount{workGroupCount}
+	{
+		this->createPipelineLayout(descriptorSetLayouts);
+		this->createPipeline();
+	}
+
+	EngineMegakernelRenderSystem::~EngineMegakernelRenderSystem() {
+		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
+	}
+
+	void EngineMegakernelRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
+		VkPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(RayTracePushConstant);
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayouts;
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+		if (vkCreatePipelineLayout(this->appDevice.getLogicalDevice(), &pipelineLayoutInfo, nullptr, &this->pipelineLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create pipeline layout!");
+		}
+	}
+
+	void EngineMegakernelRenderSystem::createPipeline() {
+		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
+
+		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault(subgroupShaderPath("megakernel", this->kernelConfig))
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.addSpecializationConstant(TRAVERSAL_STACK_SIZE_CONSTANT_ID, this->kernelConfig.traversalStackSize)
+			.addSpecializationConstant(TRAVERSAL_SPILL_SIZE_CONSTANT_ID, this->kernelConfig.traversalSpillSize)
+			.addSpecializationConstant(BACKFACE_CULLING_CONSTANT_ID, this->kernelConfig.isBackfaceCulling)
+			.addSpecializationConstant(MAX_BOUNCE_CONSTANT_ID, this->kernelConfig.maxBounce)
+			.addSpecializationConstant(ROULETTE_START_BOUNCE_CONSTANT_ID, this->kernelConfig.rouletteStartBounce)
+			.addSpecializationConstant(LIGHT_FLAGS_CONSTANT_ID, this->kernelConfig.lightFlags)
+			.addSpecializationConstant(SAMPLE_SEQUENCE_CONSTANT_ID, this->kernelConfig.sampleSequence)
+			.build();
+	}
+
+	void EngineMegakernelRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed) {
+		this->pipeline->bind(commandBuffer->getCommandBuffer());
+
+		vkCmdBindDescriptorSets(
+			commandBuffer->getCommandBuffer(),
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			this->pipelineLayout,
+			0,
+			1,
+			&descriptorSets,
+			0,
+			nullptr
+		);
+
+		RayTracePushConstant pushConstant{};
+		pushConstant.randomSeed = randomSeed;
+
+		vkCmdPushConstants(
+			commandBuffer->getCommandBuffer(), 
+			this->pipelineLayout, 
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			sizeof(RayTracePushConstant),
+			&pushConstant
+		);
+
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), this->workGroupCount, 1u, 1u);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../../../vulkan/command/command_buffer.hpp"
+#include "../../../vulkan/device/device.hpp"
+#include "../../../vulkan/pipeline/compute_pipeline.hpp"
+#include "../../../vulkan/buffer/buffer.hpp"
+#include "../../../vulkan/descriptor/descriptor.hpp"
+#include "../../../vulkan/swap_chain/swap_chain.hpp"
+#include "../../utils/camera/camera.hpp"
+#include "../../utils/kernel/kernel_config.hpp"
+#include "../../ray_ubo.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace nugiEngine {
+	class EngineMegakernelRenderSystem {
+		public:
+			// Enough resident workgroups to fill a large GPU, idle ones leave as soon as the work queue runs dry
+			static constexpr uint32_t PERSISTENT_WORKGROUP_COUNT = 1024u;
+
+			EngineMegakernelRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, const KernelConfig& kernelConfig, uint32_t workGroupCount = PERSISTENT_WORKGROUP_COUNT);
+			~EngineMegakernelRenderSystem();
+
+			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed = 1);
+
+		private:
+			void createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts);
+			void createPipeline();
+
+			EngineDevice& appDevice;
+			
+			VkPipelineLayout pipelineLayout;
+			std::unique_ptr<EngineComputePipeline> pipeline;
+
+			KernelConfig kernelConfig;
+			uint32_t workGroupCount;
+	};
+}
\ No newline at end of file
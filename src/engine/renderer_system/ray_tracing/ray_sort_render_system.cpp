@@ -0,0 +1,100 @@
+#include "ray_sort_render_system.hpp"
+
+#include <stdexcept>
+#include <array>
+#include <string>
+
+namespace nugiEngine {
+	EngineRaySortRenderSystem::EngineRaySortRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const std::string& keyShaderFilePath, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, nSample{nSample}, kernelConfig{kernelConfig}
+	{
+		this->createPipelineLayout(descriptorSetLayouts);
+		this->createPipeline(keyShaderFilePath);
+	}
+
+	EngineRaySortRenderSystem::~EngineRaySortRenderSystem() {
+		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
+	}
+
+	void EngineRaySortRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
+		VkPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(RaySortPushConstant);
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayouts;
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+		if (vkCreatePipelineLayout(this->appDevice.getLogicalDevice(), &pipelineLayoutInfo, nullptr, &this->pipelineLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create pipeline layout!");
+		}
+	}
+
+	// Only the key differs between sorts, the scan and scatter passes are shared
+	void EngineRaySortRenderSystem::createPipeline(const std::string& keyShaderFilePath) {
+		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
+
+		this->keyPipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault(keyShaderFilePath)
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.build();
+
+		this->scanPipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault("shader/ray_sort_scan.comp.spv")
+			.build();
+
+		this->scatterPipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault("shader/ray_sort_scatter.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.build();
+	}
+
+	void EngineRaySortRenderSystem::bindPipeline(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, EngineComputePipeline* pipeline) {
+		pipeline->bind(commandBuffer->getCommandBuffer());
+
+		vkCmdBindDescriptorSets(
+			commandBuffer->getCommandBuffer(),
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			this->pipelineLayout,
+			0,
+			1,
+			&descriptorSets,
+			0,
+			nullptr
+		);
+	}
+
+	void EngineRaySortRenderSystem::renderKey(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets) {
+		this->bindPipeline(commandBuffer, descriptorSets, this->keyPipeline.get());
+		this->keyPipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / this->kernelConfig.workGroupSize, 1u, 1u);
+	}
+
+	// The bucket table is small enough for a single workgroup to scan
+	void EngineRaySortRenderSystem::renderScan(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets) {
+		this->bindPipeline(commandBuffer, descriptorSets, this->scanPipeline.get());
+		this->scanPipeline->dispatch(commandBuffer->getCommandBuffer(), 1u, 1u, 1u);
+	}
+
+	// The identity order lets a caller skip the key and scan passes while keeping the order buffer valid
+	void EngineRaySortRenderSystem::renderScatter(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, bool isIdentityOrder) {
+		this->bindPipeline(commandBuffer, descriptorSets, this->scatterPipeline.get());
+
+		RaySortPushConstant pushConstant{};
+		pushConstant.isIdentityOrder = isIdentityOrder ? 1u : 0u;
+
+		vkCmdPushConstants(
+			commandBuffer->getCommandBuffer(), 
+			this->pipelineLayout, 
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			sizeof(RaySortPushConstant),
+			&pushConstant
+		);
+
+		this->scatterPipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / this->kernelConfig.workGroupSize, 1u, 1u);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../../../vulkan/command/command_buffer.hpp"
+#include "../../../vulkan/device/device.hpp"
+#include "../../../vulkan/pipeline/compute_pipeline.hpp"
+#include "../../../vulkan/buffer/buffer.hpp"
+#include "../../../vulkan/descriptor/descriptor.hpp"
+#include "../../../vulkan/swap_chain/swap_chain.hpp"
+#include "../../utils/camera/camera.hpp"
+#include "../../utils/kernel/kernel_config.hpp"
+#include "../../ray_ubo.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nugiEngine {
+	class EngineRaySortRenderSystem {
+		public:
+			EngineRaySortRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const std::string& keyShaderFilePath, const KernelConfig& kernelConfig);
+			~EngineRaySortRenderSystem();
+
+			void renderKey(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets);
+			void renderScan(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets);
+			void renderScatter(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, bool isIdentityOrder = false);
+
+		private:
+			void createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts);
+			void createPipeline(const std::string& keyShaderFilePath);
+			void bindPipeline(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, EngineComputePipeline* pipeline);
+
+			EngineDevice& appDevice;
+			
+			VkPipelineLayout pipelineLayout;
+			std::unique_ptr<EngineComputePipeline> keyPipeline;
+			std::unique_ptr<EngineComputePipeline> scanPipeline;
+			std::unique_ptr<EngineComputePipeline> scatterPipeline;
+
+			uint32_t width, height, nSample;
+			KernelConfig kernelConfig;
+	};
+}
\ No newline at end of file
@@ -1,4 +1,4 @@
-#include "sampling_ray_raster_render_system.hpp"
+#include "shade_render_system.hpp"
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
@@ -10,20 +10,20 @@
 #include <string>
 
 namespace nugiEngine {
-	EngineSamplingRayRasterRenderSystem::EngineSamplingRayRasterRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, VkRenderPass renderPass)
-		: appDevice{device}
+	EngineShadeRenderSystem::EngineShadeRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, uint32_t width, uint32_t height, uint32_t nSample, const KernelConfig& kernelConfig) 
+		: appDevice{device}, width{width}, height{height}, nSample{nSample}, kernelConfig{kernelConfig}
 	{
 		this->createPipelineLayout(descriptorSetLayouts);
-		this->createPipeline(renderPass);
+		this->createPipeline();
 	}
 
-	EngineSamplingRayRasterRenderSystem::~EngineSamplingRayRasterRenderSystem() {
+	EngineShadeRenderSystem::~EngineShadeRenderSystem() {
 		vkDestroyPipelineLayout(this->appDevice.getLogicalDevice(), this->pipelineLayout, nullptr);
 	}
 
-	void EngineSamplingRayRasterRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
+	void EngineShadeRenderSystem::createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts) {
 		VkPushConstantRange pushConstantRange{};
-		pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
 		pushConstantRange.offset = 0;
 		pushConstantRange.size = sizeof(RayTracePushConstant);
 
@@ -39,20 +39,23 @@ namespace nugiEngine {
 		}
 	}
 
-	void EngineSamplingRayRasterRenderSystem::createPipeline(VkRenderPass renderPass) {
+	void EngineShadeRenderSystem::createPipeline() {
 		assert(this->pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
 
-		this->pipeline = EngineGraphicPipeline::Builder(this->appDevice, this->pipelineLayout, renderPass)
-			.setDefault("shader/sampling.vert.spv", "shader/sampling.frag.spv")
+		this->pipeline = EngineComputePipeline::Builder(this->appDevice, this->pipelineLayout)
+			.setDefault("shader/shade.comp.spv")
+			.addSpecializationConstant(WORKGROUP_SIZE_CONSTANT_ID, this->kernelConfig.workGroupSize)
+			.addSpecializationConstant(SAMPLE_SEQUENCE_CONSTANT_ID, this->kernelConfig.sampleSequence)
+			.addSpecializationConstant(SAMPLES_PER_PIXEL_CONSTANT_ID, this->kernelConfig.samplesPerPixel)
 			.build();
 	}
 
-	void EngineSamplingRayRasterRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, std::shared_ptr<EngineVertexModel> model, uint32_t randomSeed) {
+	void EngineShadeRenderSystem::render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, uint32_t randomSeed) {
 		this->pipeline->bind(commandBuffer->getCommandBuffer());
 
 		vkCmdBindDescriptorSets(
 			commandBuffer->getCommandBuffer(),
-			VK_PIPELINE_BIND_POINT_GRAPHICS,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
 			this->pipelineLayout,
 			0,
 			1,
@@ -67,13 +70,12 @@ namespace nugiEngine {
 		vkCmdPushConstants(
 			commandBuffer->getCommandBuffer(), 
 			this->pipelineLayout, 
-			VK_SHADER_STAGE_FRAGMENT_BIT,
+			VK_SHADER_STAGE_COMPUTE_BIT,
 			0,
 			sizeof(RayTracePushConstant),
 			&pushConstant
 		);
 
-		model->bind(commandBuffer);
-		model->draw(commandBuffer);
+		this->pipeline->dispatch(commandBuffer->getCommandBuffer(), (this->width * this->height * this->nSample) / this->kernelConfig.workGroupSize, 1u, 1u);
 	}
 }
\ No newline at end of file
@@ -1,33 +0,0 @@
-#pragma once
-
-#include "../../vulkan/command/command_buffer.hpp"
-#include "../../vulkan/device/device.hpp"
-#include "../../vulkan/pipeline/graphic_pipeline.hpp"
-#include "../../vulkan/buffer/buffer.hpp"
-#include "../../vulkan/descriptor/descriptor.hpp"
-#include "../../vulkan/swap_chain/swap_chain.hpp"
-#include "../data/model/vertex_model.hpp"
-#include "../utils/camera/camera.hpp"
-#include "../ray_ubo.hpp"
-
-#include <memory>
-#include <vector>
-
-namespace nugiEngine {
-	class EngineSamplingRayRasterRenderSystem {
-		public:
-			EngineSamplingRayRasterRenderSystem(EngineDevice& device, VkDescriptorSetLayout descriptorSetLayouts, VkRenderPass renderPass);
-			~EngineSamplingRayRasterRenderSystem();
-
-			void render(std::shared_ptr<EngineCommandBuffer> commandBuffer, VkDescriptorSet descriptorSets, std::shared_ptr<EngineVertexModel> model, uint32_t randomSeed = 1);
-		
-		private:
-			void createPipelineLayout(VkDescriptorSetLayout descriptorSetLayouts);
-			void createPipeline(VkRenderPass renderPass);
-
-			EngineDevice& appDevice;
-			
-			VkPipelineLayout pipelineLayout;
-			std::unique_ptr<EngineGraphicPipeline> pipeline;
-	};
-}
\ No newline at end of file
@@ -34,13 +34,6 @@ namespace nugiEngine {
     };
   }
 
-  Aabb TriangleLightBoundBox::boundingBox() {
-    return Aabb { 
-      glm::min(glm::min(this->vertices->at(this->light.indices.x).position, this->vertices->at(this->light.indices.y).position), this->vertices->at(this->light.indices.z).position) - eps,
-      glm::max(glm::max(this->vertices->at(this->light.indices.x).position, this->vertices->at(this->light.indices.y).position), this->vertices->at(this->light.indices.z).position) + eps
-    };
-  }
-
   ObjectBoundBox::ObjectBoundBox(uint32_t i, Object &o, std::shared_ptr<std::vector<Primitive>> p, std::shared_ptr<TransformComponent> t, std::shared_ptr<std::vector<RayTraceVertex>> v) : BoundBox(i), object{o}, primitives{p}, transformation{t}, vertices{v} {
     this->originalMin = glm::vec3(this->findMin(0), this->findMin(1), this->findMin(2));
     this->originalMax = glm::vec3(this->findMax(0), this->findMax(1), this->findMax(2));
@@ -311,4 +304,30 @@ namespace nugiEngine {
 
     return output;
   }
+
+  uint32_t bvhHeight(const std::vector<BvhNode> &nodes) {
+    if (nodes.empty()) {
+      return 0u;
+    }
+
+    uint32_t height = 0u;
+    std::stack<std::pair<uint32_t, uint32_t>> nodeStack;
+    nodeStack.push({ 1u, 0u });
+
+    while (!nodeStack.empty()) {
+      auto [nodeIndex, depth] = nodeStack.top();
+      nodeStack.pop();
+
+      const BvhNode &node = nodes[nodeIndex - 1u];
+      if (node.leftNode == 0u && node.rightNode == 0u) {
+        height = std::max(height, depth);
+        continue;
+      }
+
+      if (node.leftNode > 0u) nodeStack.push({ node.leftNode, depth + 1u });
+      if (node.rightNode > 0u) nodeStack.push({ node.rightNode, depth + 1u });
+    }
+
+    return height;
+  }
 }
\ No newline at end of file
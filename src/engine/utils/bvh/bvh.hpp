@@ -12,6 +12,7 @@
 #include <memory>
 #include <algorithm>
 #include <stack>
+#include <utility>
 
 #define SPLIT_NUMBER 12
 
@@ -71,15 +72,6 @@ namespace nugiEngine {
       float findMin(uint32_t index);
   };
 
-  struct TriangleLightBoundBox : BoundBox {
-    TriangleLight &light;
-    std::shared_ptr<std::vector<RayTraceVertex>> vertices;
-
-    TriangleLightBoundBox(int i, TriangleLight &l, std::shared_ptr<std::vector<RayTraceVertex>> v) : BoundBox(i), light{l}, vertices{v} {}
-
-    Aabb boundingBox();
-  };
-
   struct BvhBinSAH {
     Aabb box;
     uint32_t objectCount;
@@ -109,4 +101,7 @@ namespace nugiEngine {
   // Stack is used instead of a tree.
   std::shared_ptr<std::vector<BvhNode>> createBvh(const std::vector<std::shared_ptr<BoundBox>> boundedBoxes);
 
+  // Interior nodes on the longest path from the root, the most far children a traversal can have waiting at once
+  uint32_t bvhHeight(const std::vector<BvhNode> &nodes);
+
 }// namespace nugiEngine 
@@ -0,0 +1,51 @@
+#include "kernel_config.hpp"
+
+#include <iostream>
+
+namespace nugiEngine {
+  // Workgroup size follows the native wave width: 64 on AMD (GCN, and RDNA in wave64), 32 on NVIDIA and everything else
+  KernelConfig selectKernelConfig(const VkPhysicalDeviceProperties &properties, const VkPhysicalDeviceSubgroupProperties &subgroupProperties) {
+    KernelConfig config{};
+
+    VkSubgroupFeatureFlags requiredOperations = VK_SUBGROUP_FEATURE_BASIC_BIT | VK_SUBGROUP_FEATURE_BALLOT_BIT | VK_SUBGROUP_FEATURE_ARITHMETIC_BIT;
+    config.isSubgroupOps = (subgroupProperties.supportedStages & VK_SHADER_STAGE_COMPUTE_BIT) != 0 
+      && (subgroupProperties.supportedOperations & requiredOperations) == requiredOperations;
+
+    // The stack depth stays the same on every vendor. A BVH over a few million triangles is deeper than 16 levels, 
+    // so a shorter stack trades occupancy for restarts on every deep traversal
+    if (properties.vendorID == AMD_VENDOR_ID) {
+      config.workGroupSize = 64u;
+    }
+
+    config.workGroupSize = std::min(config.workGroupSize, std::min(properties.limits.maxComputeWorkGroupSize[0], properties.limits.maxComputeWorkGroupInvocations));
+
+    // Two stacks of 32 bit entries per lane: the object and the primitive traversal
+    uint32_t maxStackSize = properties.limits.maxComputeSharedMemorySize / (2u * config.workGroupSize * static_cast<uint32_t>(sizeof(uint32_t)));
+    if (maxStackSize < config.traversalStackSize) {
+      std::cerr << "Warning: shared memory limit lowers the traversal stack from " << config.traversalStackSize << " to " << maxStackSize 
+        << " entries, deeper traversals spill to private memory\n";
+      config.traversalStackSize = maxStackSize;
+    }
+
+    return config;
+  }
+
+  uint32_t traversalSharedMemorySize(const KernelConfig &config) {
+    return 2u * std::max(config.traversalStackSize, 1u) * config.workGroupSize * static_cast<uint32_t>(sizeof(uint32_t));
+  }
+
+  // The newest waiting node stays in a register, so a BVH of the given height needs one entry less than that in memory.
+  // Without the shared stack every entry goes to the spill array, which is how the two are compared
+  void fitTraversalSpill(KernelConfig &config, uint32_t bvhHeight, bool isSharedStack) {
+    if (!isSharedStack) {
+      config.traversalStackSize = 0u;
+    }
+
+    uint32_t memoryEntries = bvhHeight > 0u ? bvhHeight - 1u : 0u;
+    config.traversalSpillSize = std::max(1u, memoryEntries > config.traversalStackSize ? memoryEntries - config.traversalStackSize : 0u);
+  }
+
+  std::string subgroupShaderPath(const std::string &kernelName, const KernelConfig &config) {
+    return "shader/" + kernelName + (config.isSubgroupOps ? "" : "_fallback") + ".comp.spv";
+  }
+}
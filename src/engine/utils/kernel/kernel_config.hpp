@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../../../vulkan/device/device.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace nugiEngine {
+  // Specialization constant ids, a kernel declares only the ones it uses but always under these ids
+  const uint32_t WORKGROUP_SIZE_CONSTANT_ID = 0u;
+  const uint32_t TRAVERSAL_STACK_SIZE_CONSTANT_ID = 1u;
+  const uint32_t BACKFACE_CULLING_CONSTANT_ID = 2u;
+  const uint32_t MAX_BOUNCE_CONSTANT_ID = 3u;
+  const uint32_t LIGHT_FLAGS_CONSTANT_ID = 4u;
+  const uint32_t SAMPLE_SEQUENCE_CONSTANT_ID = 5u;
+  const uint32_t SAMPLES_PER_PIXEL_CONSTANT_ID = 6u;
+  const uint32_t ROULETTE_START_BOUNCE_CONSTANT_ID = 7u;
+  const uint32_t TRAVERSAL_SPILL_SIZE_CONSTANT_ID = 8u;
+
+  // Light types with a direct light pass, a type the scene lacks has no pass writing its records
+  const uint32_t AREA_LIGHT_FLAG = 1u;
+  const uint32_t SUN_LIGHT_FLAG = 2u;
+
+  // Sequences of core/sampler.glsl
+  const uint32_t SOBOL_SAMPLE_SEQUENCE = 0u;
+  const uint32_t BLUE_NOISE_SAMPLE_SEQUENCE = 1u;
+
+  const uint32_t AMD_VENDOR_ID = 0x1002;
+  const uint32_t NVIDIA_VENDOR_ID = 0x10DE;
+
+  struct KernelConfig {
+    uint32_t workGroupSize = 32u;
+    uint32_t traversalStackSize = 32u;
+
+    // Private entries past the shared ones, enough for the tallest BVH of the scene
+    uint32_t traversalSpillSize = 1u;
+    VkBool32 isBackfaceCulling = VK_FALSE;
+    uint32_t maxBounce = 32u;
+    uint32_t rouletteStartBounce = 3u;
+    uint32_t lightFlags = AREA_LIGHT_FLAG | SUN_LIGHT_FLAG;
+    uint32_t sampleSequence = SOBOL_SAMPLE_SEQUENCE;
+
+    // Path slots per pixel. A power of two no larger than workGroupSize, so the slots of a pixel share a workgroup
+    uint32_t samplesPerPixel = 1u;
+
+    // Kernels including core/subgroup.glsl come in two binaries, the fallback one is built without subgroup operations
+    bool isSubgroupOps = false;
+  };
+
+  KernelConfig selectKernelConfig(const VkPhysicalDeviceProperties &properties, const VkPhysicalDeviceSubgroupProperties &subgroupProperties);
+  std::string subgroupShaderPath(const std::string &kernelName, const KernelConfig &config);
+  uint32_t traversalSharedMemorySize(const KernelConfig &config);
+  void fitTraversalSpill(KernelConfig &config, uint32_t bvhHeight, bool isSharedStack);
+  
+}
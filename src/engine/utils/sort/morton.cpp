@@ -36,20 +36,32 @@ namespace nugiEngine {
     return aValue < bValue;
   }
 
-  std::shared_ptr<std::vector<IndirectSamplerData>> sortPixelByMorton(uint32_t width, uint32_t height) {
+  std::shared_ptr<std::vector<IndirectSamplerData>> sortPixelByMorton(uint32_t width, uint32_t height, uint32_t samplesPerPixel) {
     auto pixels = std::make_shared<std::vector<IndirectSamplerData>>();
 
     Ray newRay{};
 
     for (uint32_t i = 0; i < width; i++) {
       for (uint32_t j = 0; j < height; j++) {
-        IndirectSamplerData pixel{ i, j, 0u, newRay };
+        IndirectSamplerData pixel{ i, j, 0u, 0u, newRay };
         pixels->emplace_back(pixel);
       }
     }
 
     std::sort(pixels->begin(), pixels->end(), mortonComparator);
-    return pixels;
+
+    // The slots of one pixel sit next to each other, each one walks its own share of the pixel's sample indices
+    auto slots = std::make_shared<std::vector<IndirectSamplerData>>();
+    slots->reserve(pixels->size() * samplesPerPixel);
+
+    for (auto &&pixel : *pixels) {
+      for (uint32_t sampleIndex = 0; sampleIndex < samplesPerPixel; sampleIndex++) {
+        pixel.sampleIndex = sampleIndex;
+        slots->emplace_back(pixel);
+      }
+    }
+
+    return slots;
   }
 }
 
@@ -15,7 +15,7 @@ namespace nugiEngine {
 
   bool mortonComparator(IndirectSamplerData a, IndirectSamplerData b);
 
-  std::shared_ptr<std::vector<IndirectSamplerData>> sortPixelByMorton(uint32_t width, uint32_t height);
+  std::shared_ptr<std::vector<IndirectSamplerData>> sortPixelByMorton(uint32_t width, uint32_t height, uint32_t samplesPerPixel);
   
 } // namespace name
 
@@ -0,0 +1,87 @@
+// ------------- Encoding ------------- 
+
+// ---------------------- hit flags ----------------------
+
+#define HIT_FLAG_HIT 1u
+#define HIT_FLAG_LIGHT 2u
+#define HIT_BOUNCE_SHIFT 8u
+
+uint packHitFlags(bool isHit, bool isLight, uint rayBounce) {
+  return (isHit ? HIT_FLAG_HIT : 0u) | (isLight ? HIT_FLAG_LIGHT : 0u) | (rayBounce << HIT_BOUNCE_SHIFT);
+}
+
+bool isHitFlagSet(HitRecord hit) {
+  return (hit.flags & HIT_FLAG_HIT) != 0u;
+}
+
+bool isLightFlagSet(HitRecord hit) {
+  return (hit.flags & HIT_FLAG_LIGHT) != 0u;
+}
+
+uint hitRayBounce(HitRecord hit) {
+  return hit.flags >> HIT_BOUNCE_SHIFT;
+}
+
+// ---------------------- shade flags ----------------------
+
+#define SHADE_KIND_MISS 1u
+#define SHADE_KIND_LIGHT 2u
+#define SHADE_KIND_SURFACE 3u
+#define SHADE_KIND_MASK 3u
+
+uint packShadeFlags(uint kind, uint rayBounce) {
+  return kind | (rayBounce << HIT_BOUNCE_SHIFT);
+}
+
+// The same classification every shading kernel uses, so the split kernels never write the same record
+uint hitShadeKind(HitRecord hit) {
+  return !isHitFlagSet(hit) ? SHADE_KIND_MISS : (isLightFlagSet(hit) ? SHADE_KIND_LIGHT : SHADE_KIND_SURFACE);
+}
+
+uint shadeKind(ShadeRecord record) {
+  return record.flags & SHADE_KIND_MASK;
+}
+
+uint shadeRayBounce(ShadeRecord record) {
+  return record.flags >> HIT_BOUNCE_SHIFT;
+}
+
+// ---------------------- normal ----------------------
+
+vec2 signNotZero(vec2 v) {
+  return vec2(v.x >= 0.0f ? 1.0f : -1.0f, v.y >= 0.0f ? 1.0f : -1.0f);
+}
+
+// Octahedral mapping of a unit vector, stored as two 16 bit snorm values
+uint encodeNormal(vec3 n) {
+  n /= abs(n.x) + abs(n.y) + abs(n.z);
+  vec2 oct = n.z >= 0.0f ? n.xy : (1.0f - abs(n.yx)) * signNotZero(n.xy);
+
+  return packSnorm2x16(oct);
+}
+
+vec3 decodeNormal(uint encoded) {
+  vec2 oct = unpackSnorm2x16(encoded);
+  vec3 n = vec3(oct, 1.0f - abs(oct.x) - abs(oct.y));
+
+  if (n.z < 0.0f) {
+    n.xy = (1.0f - abs(n.yx)) * signNotZero(n.xy);
+  }
+
+  return normalize(n);
+}
+
+// ---------------------- radiance ----------------------
+
+// Half precision is only used for bounded values (throughput, pdf, sky color), never for light contributions
+uvec2 packRadiance(vec3 radiance, float w) {
+  return uvec2(packHalf2x16(radiance.xy), packHalf2x16(vec2(radiance.z, w)));
+}
+
+vec3 unpackRadiance(uvec2 packed) {
+  return vec3(unpackHalf2x16(packed.x), unpackHalf2x16(packed.y).x);
+}
+
+float unpackRadianceW(uvec2 packed) {
+  return unpackHalf2x16(packed.y).y;
+}
@@ -0,0 +1,69 @@
+// ------------- Path State -------------
+
+// The rays and hits of all path slots are stored as structure of arrays. Each buffer is a run of planes of 16 byte vectors,
+// one vector per slot, so neighbouring invocations load neighbouring vectors and a kernel only pays for the planes it reads.
+// A plane holds as many vectors as there are slots, that count is the length of the buffer over its plane count
+
+// ---------------------- ray ----------------------
+
+// plane 0 : origin, dirMax
+// plane 1 : direction, rayBounce
+#define RAY_PLANE_COUNT 2u
+
+// Every ray starts the same distance off its surface, so the near end is not stored per path
+#define RAY_MIN_DISTANCE 0.01f
+
+uvec4 rayOriginPlane(RayData rayData) {
+  return uvec4(floatBitsToUint(rayData.ray.origin), floatBitsToUint(rayData.dirMax));
+}
+
+uvec4 rayDirectionPlane(RayData rayData) {
+  return uvec4(floatBitsToUint(rayData.ray.direction), rayData.rayBounce);
+}
+
+RayData unpackRayData(uvec4 originPlane, uvec4 directionPlane) {
+  RayData rayData;
+  rayData.ray.origin = uintBitsToFloat(originPlane.xyz);
+  rayData.ray.direction = uintBitsToFloat(directionPlane.xyz);
+  rayData.dirMax = uintBitsToFloat(originPlane.w);
+  rayData.rayBounce = directionPlane.w;
+
+  return rayData;
+}
+
+vec3 unpackRayDirection(uvec4 directionPlane) {
+  return uintBitsToFloat(directionPlane.xyz);
+}
+
+// ---------------------- hit ----------------------
+
+// plane 0 : flags, hitIndex, materialIndex, normal
+// plane 1 : point, t
+// plane 2 : uv
+#define HIT_PLANE_COUNT 3u
+
+uvec4 hitHeaderPlane(HitRecord hit) {
+  return uvec4(hit.flags, hit.hitIndex, hit.materialIndex, hit.normal);
+}
+
+uvec4 hitPointPlane(HitRecord hit) {
+  return uvec4(floatBitsToUint(hit.point), floatBitsToUint(hit.t));
+}
+
+uvec4 hitUvPlane(HitRecord hit) {
+  return uvec4(floatBitsToUint(hit.uv), 0u, 0u);
+}
+
+// Enough to tell what was hit, the point and uv stay zero until unpackHitPoint / unpackHitUv
+HitRecord unpackHitHeader(uvec4 headerPlane) {
+  return HitRecord(headerPlane.x, headerPlane.y, headerPlane.z, headerPlane.w, vec3(0.0f), 0.0f, vec2(0.0f));
+}
+
+void unpackHitPoint(inout HitRecord hit, uvec4 pointPlane) {
+  hit.point = uintBitsToFloat(pointPlane.xyz);
+  hit.t = uintBitsToFloat(pointPlane.w);
+}
+
+void unpackHitUv(inout HitRecord hit, uvec4 uvPlane) {
+  hit.uv = uintBitsToFloat(uvPlane.xy);
+}
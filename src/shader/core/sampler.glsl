@@ -0,0 +1,113 @@
+// ------------- Sampler -------------
+
+// Owen scrambled Sobol points, following Burley's "Practical Hash-based Owen Scrambling".
+// Every decision of a path takes its own 2D dimension, the points of one dimension are shuffled and scrambled
+// with a seed of their own so the dimensions stay uncorrelated without a high dimensional Sobol table
+
+#define SOBOL_SAMPLE_SEQUENCE 0u
+#define BLUE_NOISE_SAMPLE_SEQUENCE 1u
+
+// Per pixel scrambling by default. The blue noise sequence shares one scramble over the whole screen and hands out
+// neighbouring indices to neighbouring pixels, so the remaining error is spread as blue noise instead of white noise
+layout(constant_id = 5) const uint SAMPLE_SEQUENCE = SOBOL_SAMPLE_SEQUENCE;
+
+// Decisions taken at every bounce, each one owns a 2D dimension
+#define CAMERA_SAMPLE_DIMENSION 0u
+#define BSDF_SAMPLE_DIMENSION 1u
+#define LIGHT_SELECT_SAMPLE_DIMENSION 2u
+#define LIGHT_POINT_SAMPLE_DIMENSION 3u
+#define ROULETTE_SAMPLE_DIMENSION 4u
+#define SAMPLE_DIMENSIONS_PER_BOUNCE 5u
+
+// Pixel coordinates above 4096 wrap in the blue noise ordering, the sample index takes the remaining 8 bits
+#define BLUE_NOISE_PIXEL_BITS 24u
+
+// ---------------------- hash ----------------------
+
+uint hashUint(uint x) {
+  x ^= x >> 16u;
+  x *= 0x7feb352du;
+  x ^= x >> 15u;
+  x *= 0x846ca68bu;
+  x ^= x >> 16u;
+  return x;
+}
+
+uint hashCombine(uint seed, uint value) {
+  return seed ^ (hashUint(value) + 0x9e3779b9u + (seed << 6u) + (seed >> 2u));
+}
+
+// ---------------------- scrambling ----------------------
+
+// Only ever flips a bit depending on the bits below it, which is what an Owen scramble of the reversed value needs
+uint laineKarrasPermutation(uint x, uint seed) {
+  x += seed;
+  x ^= x * 0x6c50b47cu;
+  x ^= x * 0xb82f1e52u;
+  x ^= x * 0xc7afe638u;
+  x ^= x * 0x8d22f6e6u;
+  return x;
+}
+
+uint nestedUniformScramble(uint x, uint seed) {
+  return bitfieldReverse(laineKarrasPermutation(bitfieldReverse(x), seed));
+}
+
+// ---------------------- sequence ----------------------
+
+// The first two Sobol dimensions: van der Corput, and the one with direction numbers v(k) = v(k - 1) ^ (v(k - 1) >> 1)
+uvec2 sobol2D(uint index) {
+  uint y = 0u;
+  uint direction = 0x80000000u;
+
+  for (uint bits = index; bits != 0u; bits >>= 1u) {
+    if ((bits & 1u) != 0u) {
+      y ^= direction;
+    }
+
+    direction ^= direction >> 1u;
+  }
+
+  return uvec2(bitfieldReverse(index), y);
+}
+
+vec2 owenSobol2D(uint index, uint seed) {
+  uvec2 point = sobol2D(nestedUniformScramble(index, seed));
+  point.x = nestedUniformScramble(point.x, hashCombine(seed, 0u));
+  point.y = nestedUniformScramble(point.y, hashCombine(seed, 1u));
+
+  // 24 bits are all a float holds, dropping the rest keeps the result below 1
+  return vec2(point >> 8u) / 16777216.0f;
+}
+
+// ---------------------- pixel order ----------------------
+
+uint spreadPixelBits(uint x) {
+  x &= 0x00000fffu;
+  x = (x ^ (x << 8u)) & 0x00ff00ffu;
+  x = (x ^ (x << 4u)) & 0x0f0f0f0fu;
+  x = (x ^ (x << 2u)) & 0x33333333u;
+  x = (x ^ (x << 1u)) & 0x55555555u;
+  return x;
+}
+
+uint pixelMortonCode(uvec2 pixelCoord) {
+  return (spreadPixelBits(pixelCoord.y) << 1u) | spreadPixelBits(pixelCoord.x);
+}
+
+// ---------------------- sample ----------------------
+
+// sampleIndex numbers the paths of the pixel, rayBounce and decision pick the dimension
+vec2 sample2D(uvec2 pixelCoord, uint sampleIndex, uint rayBounce, uint decision) {
+  uint dimensionSeed = hashUint(rayBounce * SAMPLE_DIMENSIONS_PER_BOUNCE + decision);
+
+  if (SAMPLE_SEQUENCE == BLUE_NOISE_SAMPLE_SEQUENCE) {
+    // Each run of 256 samples gets a fresh scramble, so the 8 bits left for the sample index never repeat a point
+    uint seed = hashCombine(dimensionSeed, sampleIndex >> (32u - BLUE_NOISE_PIXEL_BITS));
+    uint pixelRank = nestedUniformScramble(pixelMortonCode(pixelCoord) << (32u - BLUE_NOISE_PIXEL_BITS), seed) >> (32u - BLUE_NOISE_PIXEL_BITS);
+
+    return owenSobol2D((sampleIndex << BLUE_NOISE_PIXEL_BITS) | pixelRank, seed);
+  }
+
+  return owenSobol2D(sampleIndex, hashCombine(dimensionSeed, pixelMortonCode(pixelCoord)));
+}
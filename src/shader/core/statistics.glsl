@@ -0,0 +1,30 @@
+// ------------- Statistics -------------
+
+// The running mean and luminance variance of every pixel, kept in floats with the exact number of paths behind them.
+// Shared by both render modes, so the adaptive mask, the denoiser and the tonemap read the same accumulation either way
+
+float luminance(vec3 color) {
+  return dot(color, vec3(0.2126f, 0.7152f, 0.0722f));
+}
+
+// Chan's parallel update, merges a group of paths given their mean radiance and the sum of their squared luminances.
+// The spread inside the group is added to the spread between its mean and the pixel's, so m2 matches adding each path alone
+void addPixelSample(inout PixelStatistics statistics, vec3 radiance, uint count, float squareLuminanceSum) {
+  float prevCount = float(statistics.sampleCount);
+  statistics.sampleCount += count;
+
+  float weight = float(count) / float(statistics.sampleCount);
+  float groupLuminance = luminance(radiance);
+  float groupM2 = max(squareLuminanceSum - float(count) * groupLuminance * groupLuminance, 0.0f);
+  float delta = groupLuminance - statistics.meanLuminance;
+
+  statistics.mean += (radiance - statistics.mean) * weight;
+  statistics.meanLuminance += delta * weight;
+  statistics.m2 += groupM2 + delta * delta * prevCount * weight;
+}
+
+// A single path, the plain Welford step
+void addPixelSample(inout PixelStatistics statistics, vec3 radiance) {
+  float sampleLuminance = luminance(radiance);
+  addPixelSample(statistics, radiance, 1u, sampleLuminance * sampleLuminance);
+}
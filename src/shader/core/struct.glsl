@@ -16,6 +16,7 @@ struct Object {
   uint firstBvhIndex;
   uint firstPrimitiveIndex;
   uint transformIndex;
+  uint isEmissive;
 };
 
 struct TriangleLight {
@@ -67,55 +68,45 @@ struct Ray {
 
 struct RayData {
   Ray ray;
-
-  float dirMin;
-  vec3 dirMax;
+  float dirMax;
 
   uint rayBounce;
 };
 
 struct HitRecord {
-  bool isHit;
-  uint rayBounce;
-
+  uint flags;
   uint hitIndex;
   uint materialIndex;
+  uint normal;
 
   vec3 point;
-  vec3 dir;
-  vec3 normal;
+  float t;
   vec2 uv;
 };
 
-struct IndirectShadeRecord {
-  bool isIlluminate;
-  vec3 radiance;
-  float pdf;
-
+// One record per path for whatever the hit turned out to be, the kind and ray bounce live in flags
+// pdf is the BSDF pdf of nextRay on a surface, and the pdf the light sampler had of reaching a light that was hit
+struct ShadeRecord {
   Ray nextRay;
-};
 
-struct DirectShadeRecord {
-  bool isIlluminate;
   vec3 radiance;
+  uint flags;
   float pdf;
 };
 
-struct LightShadeRecord {
+// radiance is already divided by the light sampler's pdf, bsdfPdf is what BSDF sampling had of the same direction
+struct DirectShadeRecord {
   bool isIlluminate;
   vec3 radiance;
-  uint rayBounce;
-};
-
-struct MissRecord {
-  bool isMiss;
-  vec3 radiance;
+  float pdf;
+  float bsdfPdf;
 };
 
 struct IndirectSamplerData {
   uint xCoord;
   uint yCoord;
   uint rayBounce;
+  uint sampleIndex;
 
   Ray nextRay;
 };
@@ -123,7 +114,10 @@ struct IndirectSamplerData {
 struct DirectData {
   bool isIlluminate;
   uint materialIndex;
-  vec3 normal;
+  uint lightIndex;
+  uint normal;
+
+  vec3 lightDir;
   vec2 uv;
 };
 
@@ -131,6 +125,25 @@ struct RenderResult {
   vec3 totalIndirect;
   vec3 totalRadiance;
   float pdf;
+
+  vec3 finishedRadiance;
+  uint finishedCount;
+  float finishedSquareLuminance;
+};
+
+struct PixelStatistics {
+  vec3 mean;
+  uint sampleCount;
+  float meanLuminance;
+  float m2;
+  uint isActive;
+};
+
+struct PixelGuide {
+  vec3 normal;
+  float depth;
+  vec3 albedo;
+  uint isHit;
 };
 
 // ---------------------- internal struct ----------------------
@@ -0,0 +1,108 @@
+// ------------- Subgroup -------------
+
+// Include right after #version, the extensions have to come before any declaration.
+// Built with NO_SUBGROUP_OPS for devices lacking ballot or arithmetic subgroup operations, every helper then acts as if
+// each invocation were a subgroup of its own, so callers stay correct and only lose the aggregation
+
+#ifndef NO_SUBGROUP_OPS
+#extension GL_KHR_shader_subgroup_basic : require
+#extension GL_KHR_shader_subgroup_ballot : require
+#extension GL_KHR_shader_subgroup_arithmetic : require
+#endif
+
+// ---------------------- election ----------------------
+
+// The lowest active invocation, the one laneBroadcastLeader reads from
+bool isLaneLeader() {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupElect();
+#else
+  return true;
+#endif
+}
+
+uint laneBroadcastLeader(uint value) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupBroadcastFirst(value);
+#else
+  return value;
+#endif
+}
+
+// Active invocations whose condition holds
+uint laneCount(bool condition) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupBallotBitCount(subgroupBallot(condition));
+#else
+  return condition ? 1u : 0u;
+#endif
+}
+
+// ---------------------- prefix sum ----------------------
+
+uint laneSum(uint value) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupAdd(value);
+#else
+  return value;
+#endif
+}
+
+// Sum of the values of the active invocations below this one, its offset inside a compacted range
+uint lanePrefixSum(uint value) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupExclusiveAdd(value);
+#else
+  return 0u;
+#endif
+}
+
+// ---------------------- reduction ----------------------
+
+uint laneMin(uint value) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupMin(value);
+#else
+  return value;
+#endif
+}
+
+uint laneMax(uint value) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupMax(value);
+#else
+  return value;
+#endif
+}
+
+float laneMin(float value) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupMin(value);
+#else
+  return value;
+#endif
+}
+
+float laneMax(float value) {
+#ifndef NO_SUBGROUP_OPS
+  return subgroupMax(value);
+#else
+  return value;
+#endif
+}
+
+// ---------------------- aggregated atomic ----------------------
+
+// atomicAdd(counter, value) with a single atomic for the whole subgroup. result gets what the counter held before this
+// invocation's share, so the shares of one subgroup land next to each other in invocation order.
+// A buffer member cannot be passed to a function, hence the macro. Every active invocation has to reach it, those with
+// nothing to add pass 0 and get a result they should ignore
+#define SUBGROUP_ATOMIC_ADD(result, counter, value) { \
+  uint aggregateValue = (value); \
+  uint aggregateTotal = laneSum(aggregateValue); \
+  uint aggregateBase = 0u; \
+  if (isLaneLeader() && aggregateTotal > 0u) { \
+    aggregateBase = atomicAdd(counter, aggregateTotal); \
+  } \
+  result = laneBroadcastLeader(aggregateBase) + lanePrefixSum(aggregateValue); \
+}
@@ -0,0 +1,91 @@
+// ------------- Traversal Stack -------------
+
+// Include after the local size, the shared part is laid out per workgroup lane.
+// Nodes waiting to be visited. The newest one stays in a register, a leaf is usually popped right after its parent pushed it.
+// The older ones go to shared memory, one column per invocation so neighbouring lanes hit different banks, and what does not
+// fit there spills to a private array. The host sizes the spill from the tallest BVH, so a deep traversal never drops a node
+
+layout(constant_id = 1) const uint TRAVERSAL_STACK_SIZE = 32u;
+layout(constant_id = 8) const uint TRAVERSAL_SPILL_SIZE = 1u;
+
+// A stack size of 0 keeps every entry in the spill array, the shared arrays then only hold a placeholder entry.
+// The object and primitive traversals are nested, so each needs its own stack
+shared uint objectStack[(TRAVERSAL_STACK_SIZE > 0u ? TRAVERSAL_STACK_SIZE : 1u) * gl_WorkGroupSize.x];
+shared uint primitiveStack[(TRAVERSAL_STACK_SIZE > 0u ? TRAVERSAL_STACK_SIZE : 1u) * gl_WorkGroupSize.x];
+
+uint objectSpillStack[TRAVERSAL_SPILL_SIZE];
+uint primitiveSpillStack[TRAVERSAL_SPILL_SIZE];
+
+struct TraversalStack {
+  uint top;   // newest node, 0 when the register is empty
+  uint count; // older nodes in shared memory, then in the spill array
+};
+
+TraversalStack emptyTraversalStack() {
+  return TraversalStack(0u, 0u);
+}
+
+bool isStackEmpty(TraversalStack stack) {
+  return stack.top == 0u && stack.count == 0u;
+}
+
+uint stackSlot(uint stackIndex) {
+  return stackIndex * gl_WorkGroupSize.x + gl_LocalInvocationIndex;
+}
+
+// ---------------------- object ----------------------
+
+void pushObjectNode(inout TraversalStack stack, uint node) {
+  if (stack.top != 0u) {
+    if (stack.count < TRAVERSAL_STACK_SIZE) {
+      objectStack[stackSlot(stack.count)] = stack.top;
+    } else {
+      objectSpillStack[stack.count - TRAVERSAL_STACK_SIZE] = stack.top;
+    }
+
+    stack.count++;
+  }
+
+  stack.top = node;
+}
+
+// Returns 0 once the stack is empty
+uint popObjectNode(inout TraversalStack stack) {
+  uint node = stack.top;
+  stack.top = 0u;
+
+  if (node == 0u && stack.count > 0u) {
+    stack.count--;
+    node = stack.count < TRAVERSAL_STACK_SIZE ? objectStack[stackSlot(stack.count)] : objectSpillStack[stack.count - TRAVERSAL_STACK_SIZE];
+  }
+
+  return node;
+}
+
+// ---------------------- primitive ----------------------
+
+void pushPrimitiveNode(inout TraversalStack stack, uint node) {
+  if (stack.top != 0u) {
+    if (stack.count < TRAVERSAL_STACK_SIZE) {
+      primitiveStack[stackSlot(stack.count)] = stack.top;
+    } else {
+      primitiveSpillStack[stack.count - TRAVERSAL_STACK_SIZE] = stack.top;
+    }
+
+    stack.count++;
+  }
+
+  stack.top = node;
+}
+
+uint popPrimitiveNode(inout TraversalStack stack) {
+  uint node = stack.top;
+  stack.top = 0u;
+
+  if (node == 0u && stack.count > 0u) {
+    stack.count--;
+    node = stack.count < TRAVERSAL_STACK_SIZE ? primitiveStack[stackSlot(stack.count)] : primitiveSpillStack[stack.count - TRAVERSAL_STACK_SIZE];
+  }
+
+  return node;
+}
@@ -47,11 +47,45 @@ namespace nugiEngine {
 
     this->createBuffer(bufferSize, usageFlags, memoryPropertyFlags);
   }
+
+  /**
+   * Creates a buffer without memory of its own, the memory is bound later by bindMemory
+   * (eg by a transient allocator that places several buffers in one allocation)
+   */
+  EngineBuffer::EngineBuffer(
+      EngineDevice &device,
+      VkDeviceSize instanceSize,
+      uint32_t instanceCount,
+      VkBufferUsageFlags usageFlags
+    )
+      : engineDevice{device},
+        instanceSize{instanceSize},
+        instanceCount{instanceCount},
+        usageFlags{usageFlags},
+        memoryPropertyFlags{VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        isMemoryOwned{false}
+  {
+    this->alignmentSize = instanceSize;
+    this->bufferSize = alignmentSize * instanceCount;
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = this->bufferSize;
+    bufferInfo.usage = usageFlags;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (vkCreateBuffer(this->engineDevice.getLogicalDevice(), &bufferInfo, nullptr, &this->buffer) != VK_SUCCESS) {
+      throw std::runtime_error("failed to create transient buffer!");
+    }
+  }
   
   EngineBuffer::~EngineBuffer() {
     this->unmap();
     vkDestroyBuffer(this->engineDevice.getLogicalDevice(), this->buffer, nullptr);
-    vkFreeMemory(this->engineDevice.getLogicalDevice(), this->memory, nullptr);
+
+    if (this->isMemoryOwned) {
+      vkFreeMemory(this->engineDevice.getLogicalDevice(), this->memory, nullptr);
+    }
   }
   
   /**
@@ -357,6 +391,26 @@ namespace nugiEngine {
     vkBindBufferMemory(this->engineDevice.getLogicalDevice(), this->buffer, this->memory, 0);
   }
 
+  /**
+   * Binds a buffer created without memory to a range of an allocation it does not own
+   *
+   * @param memory The allocation, freed by its owner and not by this buffer
+   * @param offset Byte offset of the buffer inside the allocation, aligned to getMemoryRequirements().alignment
+   */
+  void EngineBuffer::bindMemory(VkDeviceMemory memory, VkDeviceSize offset) {
+    assert(!this->isMemoryOwned && this->memory == VK_NULL_HANDLE && "Cannot rebind a buffer that already has memory");
+
+    this->memory = memory;
+    vkBindBufferMemory(this->engineDevice.getLogicalDevice(), this->buffer, this->memory, offset);
+  }
+
+  VkMemoryRequirements EngineBuffer::getMemoryRequirements() const {
+    VkMemoryRequirements memRequirements;
+    vkGetBufferMemoryRequirements(this->engineDevice.getLogicalDevice(), this->buffer, &memRequirements);
+
+    return memRequirements;
+  }
+
   void EngineBuffer::copyBuffer(VkBuffer srcBuffer, VkDeviceSize size) {
     EngineCommandBuffer commandBuffer{this->engineDevice};
     commandBuffer.beginSingleTimeCommand();
@@ -16,9 +16,15 @@ class EngineBuffer {
       VkBufferUsageFlags usageFlags,
       VkMemoryPropertyFlags memoryPropertyFlags,
       VkDeviceSize minOffsetAlignment = 1);
+  EngineBuffer(
+      EngineDevice& device,
+      VkDeviceSize instanceSize,
+      uint32_t instanceCount,
+      VkBufferUsageFlags usageFlags);
   ~EngineBuffer();
 
   void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties);
+  void bindMemory(VkDeviceMemory memory, VkDeviceSize offset);
   void copyBuffer(VkBuffer srcBuffer, VkDeviceSize size);
   void copyBufferToImage(VkImage image, uint32_t width, uint32_t height, uint32_t layerCount);
  
@@ -50,6 +56,7 @@ class EngineBuffer {
   VkBufferUsageFlags getUsageFlags() const { return usageFlags; }
   VkMemoryPropertyFlags getMemoryPropertyFlags() const { return memoryPropertyFlags; }
   VkDeviceSize getBufferSize() const { return bufferSize; }
+  VkMemoryRequirements getMemoryRequirements() const;
 
   static void transitionBuffer(std::vector<std::shared_ptr<EngineBuffer>> buffers, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage, 
     VkAccessFlags srcAccess, VkAccessFlags dstAccess, uint32_t srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED, 
@@ -64,6 +71,7 @@ class EngineBuffer {
   void* mapped = nullptr;
   VkBuffer buffer = VK_NULL_HANDLE;
   VkDeviceMemory memory = VK_NULL_HANDLE;
+  bool isMemoryOwned = true;
  
   VkDeviceSize bufferSize;
   uint32_t instanceCount;
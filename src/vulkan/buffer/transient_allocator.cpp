@@ -0,0 +1,158 @@
+#include "transient_allocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+namespace nugiEngine {
+	EngineTransientAllocator::EngineTransientAllocator(EngineDevice &device) : engineDevice{device} {}
+
+	EngineTransientAllocator::~EngineTransientAllocator() {
+		if (this->memory != VK_NULL_HANDLE) {
+			vkFreeMemory(this->engineDevice.getLogicalDevice(), this->memory, nullptr);
+		}
+	}
+
+	// The buffers are only created here, they get their memory once the stages using them are marked and allocate() is called
+	std::vector<std::shared_ptr<EngineBuffer>> EngineTransientAllocator::createBuffers(VkDeviceSize instanceSize, uint32_t instanceCount, VkBufferUsageFlags usageFlags) {
+		assert(!this->allocated && "Cannot create transient buffers after allocation");
+
+		std::vector<std::shared_ptr<EngineBuffer>> buffers;
+
+		for (uint32_t i = 0; i < EngineDevice::MAX_FRAMES_IN_FLIGHT; i++) {
+			auto buffer = std::make_shared<EngineBuffer>(this->engineDevice, instanceSize, instanceCount, usageFlags);
+
+			TransientBuffer transientBuffer{};
+			transientBuffer.buffer = buffer;
+			transientBuffer.frameIndex = i;
+
+			this->transientBuffers.emplace_back(transientBuffer);
+			buffers.emplace_back(buffer);
+		}
+
+		return buffers;
+	}
+
+	// A stage reading or writing the buffer, the buffer is live from the first to the last stage marked. Buffers the allocator
+	// does not own are ignored, so a caller can mark every buffer a stage touches
+	void EngineTransientAllocator::markUse(VkBuffer buffer, uint32_t stage) {
+		for (auto &&transientBuffer : this->transientBuffers) {
+			if (transientBuffer.buffer->getBuffer() != buffer) {
+				continue;
+			}
+
+			assert(!this->allocated && "Cannot extend the lifetime of a transient buffer after allocation");
+
+			transientBuffer.firstStage = std::min(transientBuffer.firstStage, stage);
+			transientBuffer.lastStage = std::max(transientBuffer.lastStage, stage);
+		}
+	}
+
+	// Frames in flight run concurrently, so buffers of different frames never share memory
+	bool EngineTransientAllocator::isLiveTogether(const TransientBuffer &a, const TransientBuffer &b) {
+		return a.isUsed() && b.isUsed() && (a.frameIndex != b.frameIndex || (a.firstStage <= b.lastStage && b.firstStage <= a.lastStage));
+	}
+
+	// Greedy placement, largest buffers first: each buffer takes the lowest offset that does not overlap 
+	// any already placed buffer whose live interval overlaps its own
+	void EngineTransientAllocator::allocate() {
+		assert(!this->allocated && "Transient buffers are already allocated");
+		this->allocated = true;
+
+		uint32_t memoryTypeBits = ~0u;
+		std::vector<size_t> placementOrder;
+
+		for (size_t i = 0; i < this->transientBuffers.size(); i++) {
+			auto &transientBuffer = this->transientBuffers[i];
+			auto memRequirements = transientBuffer.buffer->getMemoryRequirements();
+
+			transientBuffer.alignment = memRequirements.alignment;
+			transientBuffer.size = (memRequirements.size + memRequirements.alignment - 1) / memRequirements.alignment * memRequirements.alignment;
+
+			memoryTypeBits &= memRequirements.memoryTypeBits;
+			this->unaliasedSize += transientBuffer.size;
+			placementOrder.emplace_back(i);
+		}
+
+		if (placementOrder.empty()) {
+			return;
+		}
+
+		std::stable_sort(placementOrder.begin(), placementOrder.end(), [this](size_t a, size_t b) {
+			return this->transientBuffers[a].size > this->transientBuffers[b].size;
+		});
+
+		std::vector<size_t> placedBuffers;
+		for (auto &&index : placementOrder) {
+			auto &transientBuffer = this->transientBuffers[index];
+			VkDeviceSize alignment = transientBuffer.alignment;
+
+			// Placed buffers that are live at the same time, sorted by offset so one pass finds the first gap
+			std::vector<size_t> liveBuffers;
+			for (auto &&placedIndex : placedBuffers) {
+				auto &placedBuffer = this->transientBuffers[placedIndex];
+
+				if (EngineTransientAllocator::isLiveTogether(placedBuffer, transientBuffer)) {
+					liveBuffers.emplace_back(placedIndex);
+				}
+			}
+
+			std::sort(liveBuffers.begin(), liveBuffers.end(), [this](size_t a, size_t b) {
+				return this->transientBuffers[a].offset < this->transientBuffers[b].offset;
+			});
+
+			VkDeviceSize offset = 0;
+			for (auto &&liveIndex : liveBuffers) {
+				auto &liveBuffer = this->transientBuffers[liveIndex];
+
+				if (offset + transientBuffer.size <= liveBuffer.offset) {
+					break;
+				}
+
+				offset = std::max(offset, (liveBuffer.offset + liveBuffer.size + alignment - 1) / alignment * alignment);
+			}
+
+			transientBuffer.offset = offset;
+			this->peakSize = std::max(this->peakSize, offset + transientBuffer.size);
+
+			placedBuffers.emplace_back(index);
+		}
+
+		// A buffer is aliased when any other buffer shares part of its range, whichever of the two comes first in the graph.
+		// The graph runs several times per command buffer, so the earlier one also takes over memory the later one just wrote
+		for (auto &&transientBuffer : this->transientBuffers) {
+			for (auto &&otherBuffer : this->transientBuffers) {
+				if (&otherBuffer != &transientBuffer && otherBuffer.isUsed() && transientBuffer.isUsed() && otherBuffer.frameIndex == transientBuffer.frameIndex 
+					&& otherBuffer.offset < transientBuffer.offset + transientBuffer.size 
+					&& transientBuffer.offset < otherBuffer.offset + otherBuffer.size) 
+				{
+					transientBuffer.isAliased = true;
+				}
+			}
+		}
+
+		VkMemoryAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.allocationSize = this->peakSize;
+		allocInfo.memoryTypeIndex = this->engineDevice.findMemoryType(memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+		if (vkAllocateMemory(this->engineDevice.getLogicalDevice(), &allocInfo, nullptr, &this->memory) != VK_SUCCESS) {
+			throw std::runtime_error("failed to allocate transient buffer memory!");
+		}
+
+		for (auto &&transientBuffer : this->transientBuffers) {
+			transientBuffer.buffer->bindMemory(this->memory, transientBuffer.offset);
+		}
+
+		std::cout << "Transient buffers: " << this->transientBuffers.size() << " buffers, peak " << (this->peakSize >> 20) 
+			<< " MB of " << (this->unaliasedSize >> 20) << " MB unaliased" << std::endl;
+	}
+
+	// Memory of an aliased buffer still holds whatever the buffer it shares memory with left behind
+	bool EngineTransientAllocator::isAliased(VkBuffer buffer) const {
+		return std::any_of(this->transientBuffers.begin(), this->transientBuffers.end(), [buffer](const TransientBuffer &transientBuffer) {
+			return transientBuffer.isAliased && transientBuffer.buffer->getBuffer() == buffer;
+		});
+	}
+} // namespace nugiEngine
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../device/device.hpp"
+#include "buffer.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace nugiEngine {
+	class EngineTransientAllocator {
+		public:
+			EngineTransientAllocator(EngineDevice &device);
+			~EngineTransientAllocator();
+
+			EngineTransientAllocator(const EngineTransientAllocator&) = delete;
+			EngineTransientAllocator& operator=(const EngineTransientAllocator&) = delete;
+
+			std::vector<std::shared_ptr<EngineBuffer>> createBuffers(VkDeviceSize instanceSize, uint32_t instanceCount, VkBufferUsageFlags usageFlags);
+			void markUse(VkBuffer buffer, uint32_t stage);
+
+			void allocate();
+			bool isAllocated() const { return this->allocated; }
+			bool isAliased(VkBuffer buffer) const;
+
+			VkDeviceSize getPeakSize() const { return this->peakSize; }
+			VkDeviceSize getUnaliasedSize() const { return this->unaliasedSize; }
+
+		private:
+			struct TransientBuffer {
+				std::shared_ptr<EngineBuffer> buffer;
+				uint32_t frameIndex;
+				uint32_t firstStage = UINT32_MAX;
+				uint32_t lastStage = 0;
+
+				VkDeviceSize offset = 0;
+				VkDeviceSize size = 0;
+				VkDeviceSize alignment = 1;
+				bool isAliased = false;
+
+				// A buffer no stage touches needs memory to be bound, but never conflicts with another one
+				bool isUsed() const { return this->firstStage <= this->lastStage; }
+			};
+
+			static bool isLiveTogether(const TransientBuffer &a, const TransientBuffer &b);
+
+			EngineDevice &engineDevice;
+			std::vector<TransientBuffer> transientBuffers;
+
+			VkDeviceMemory memory = VK_NULL_HANDLE;
+			bool allocated = false;
+			VkDeviceSize peakSize = 0;
+			VkDeviceSize unaliasedSize = 0;
+	};
+} // namespace nugiEngine
@@ -134,7 +134,14 @@ namespace nugiEngine {
       throw std::runtime_error("failed to find a suitable GPU!");
     }
 
-    vkGetPhysicalDeviceProperties(this->physicalDevice, &this->properties);
+    this->subgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties2{};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties2.pNext = &this->subgroupProperties;
+
+    vkGetPhysicalDeviceProperties2(this->physicalDevice, &properties2);
+    this->properties = properties2.properties;
     std::cout << "physical device: " << this->properties.deviceName << std::endl;
   }
 
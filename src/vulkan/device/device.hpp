@@ -54,6 +54,7 @@ namespace nugiEngine {
       QueueFamilyIndices getFamilyIndices() { return this->familyIndices; }
       
       VkPhysicalDeviceProperties getProperties() { return this->properties; }
+      VkPhysicalDeviceSubgroupProperties getSubgroupProperties() { return this->subgroupProperties; }
       VkSampleCountFlagBits getMSAASamples() { return this->msaaSamples; }
 
       SwapChainSupportDetails getSwapChainSupport() { return this->querySwapChainSupport(this->physicalDevice); }
@@ -89,6 +90,7 @@ namespace nugiEngine {
       VkDevice device;
       VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
       VkPhysicalDeviceProperties properties;
+      VkPhysicalDeviceSubgroupProperties subgroupProperties{};
 
       // window system
       EngineWindow &window;
@@ -44,6 +44,18 @@ namespace nugiEngine {
 		return *this;
   }
 
+	EngineComputePipeline::Builder EngineComputePipeline::Builder::addSpecializationConstant(uint32_t constantId, uint32_t value) {
+		VkSpecializationMapEntry entry{};
+		entry.constantID = constantId;
+		entry.offset = static_cast<uint32_t>(this->configInfo.specializationDatas.size() * sizeof(uint32_t));
+		entry.size = sizeof(uint32_t);
+
+		this->configInfo.specializationEntries.emplace_back(entry);
+		this->configInfo.specializationDatas.emplace_back(value);
+
+		return *this;
+	}
+
 	std::unique_ptr<EngineComputePipeline> EngineComputePipeline::Builder::build() {
 		return std::make_unique<EngineComputePipeline>(
 			this->appDevice,
@@ -86,6 +98,17 @@ namespace nugiEngine {
 		pipelineInfo.basePipelineHandle = configInfo.basePipelineHandleInfo;
 		pipelineInfo.stage = configInfo.shaderStageInfo;
 
+		// Only has to outlive the create call, the builder copies the config around by value
+		VkSpecializationInfo specializationInfo{};
+		if (!configInfo.specializationEntries.empty()) {
+			specializationInfo.mapEntryCount = static_cast<uint32_t>(configInfo.specializationEntries.size());
+			specializationInfo.pMapEntries = configInfo.specializationEntries.data();
+			specializationInfo.dataSize = configInfo.specializationDatas.size() * sizeof(uint32_t);
+			specializationInfo.pData = configInfo.specializationDatas.data();
+
+			pipelineInfo.stage.pSpecializationInfo = &specializationInfo;
+		}
+
 		if (vkCreateComputePipelines(this->engineDevice.getLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &this->computePipeline) != VK_SUCCESS) {
 			throw std::runtime_error("failed to create compute pipelines");
 		}
@@ -112,4 +135,8 @@ namespace nugiEngine {
 		vkCmdDispatch(commandBuffer, xSize, ySize, zSize);
 	}
 
+	void EngineComputePipeline::dispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+		vkCmdDispatchIndirect(commandBuffer, buffer, offset);
+	}
+
 } // namespace nugiEngine
@@ -13,6 +13,10 @@ namespace nugiEngine {
     VkPipelineShaderStageCreateInfo shaderStageInfo{};
     VkPipeline basePipelineHandleInfo{};
     int32_t basePipelineIndex;
+
+    // Every constant is a 32 bit value, laid out one after another in specializationDatas
+    std::vector<VkSpecializationMapEntry> specializationEntries{};
+    std::vector<uint32_t> specializationDatas{};
 	};
 	
 	class EngineComputePipeline {
@@ -25,6 +29,7 @@ namespace nugiEngine {
 					Builder setShaderStageInfo(VkPipelineShaderStageCreateInfo shaderStagesInfo);
           Builder setBasePipelineHandleInfo(VkPipeline basePipeline);
           Builder setBasePipelineIndex(int32_t basePipelineIndex);
+					Builder addSpecializationConstant(uint32_t constantId, uint32_t value);
 
 					std::unique_ptr<EngineComputePipeline> build();
 
@@ -38,6 +43,7 @@ namespace nugiEngine {
 
 			void bind(VkCommandBuffer commandBuffer);
 			void dispatch(VkCommandBuffer commandBuffer, uint32_t xSize, uint32_t ySize, uint32_t zSize);
+			void dispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset = 0);
 
 		private:
 			EngineDevice& engineDevice;
@@ -32,6 +32,10 @@ namespace nugiEngine {
     glfwPollEvents();
   }
 
+  void EngineWindow::waitEvents() {
+    glfwWaitEvents();
+  }
+
   void EngineWindow::createWindowSurface(VkInstance instance, VkSurfaceKHR* surface) {
     if (glfwCreateWindowSurface(instance, this->window, nullptr, surface) != VK_SUCCESS) {
       throw std::runtime_error("failed to create window surface");
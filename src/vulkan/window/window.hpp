@@ -15,6 +15,7 @@ namespace nugiEngine {
 
 			bool shouldClose();
 			void pollEvents();
+			void waitEvents();
 
 			void createWindowSurface(VkInstance instance, VkSurfaceKHR* surface);
 			VkExtent2D getExtent();